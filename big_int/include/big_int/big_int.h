@@ -5,12 +5,23 @@
 #ifndef BIG_INT_H
 #define BIG_INT_H
 
+#include "limb_vector.h"
+
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
 #include <vector>
 #include <string>
+#include <string_view>
+
+class chunked_digit_writer;
 
 struct bint_t {
     bool sign;
-    std::vector<uint64_t> data;
+    // Little-endian limbs, small numbers are stored inline without heap allocation
+    limb_vector data;
 
     bint_t();
     bint_t(const bint_t& other) = default;
@@ -19,6 +30,12 @@ struct bint_t {
     explicit bint_t(int64_t value);
     explicit bint_t(int value);
 
+    // `int64_t` and `long long` are distinct types on some platforms, route the rest of integral types explicitly
+    template<std::signed_integral T>
+    explicit bint_t(T value) : bint_t(static_cast<int64_t>(value)) {}
+    template<std::unsigned_integral T>
+    explicit bint_t(T value) : bint_t(static_cast<uint64_t>(value)) {}
+
     bint_t& pow(int n);
     [[nodiscard]] bint_t pow(int n) const;
 
@@ -44,15 +61,74 @@ struct bint_t {
     bint_t& operator<<=(int64_t n);
     bint_t& operator>>=(int64_t n);
 
-    [[nodiscard]] std::string to_string() const;
+    /**
+     * Digits in the radix from 2 to 36 with a leading `-` for negative numbers, the letter digits are lowercase.
+     * Power-of-two radixes are converted in linear time, the rest are converted with divide-and-conquer.
+     */
+    [[nodiscard]] std::string to_string(int radix = 10) const;
     [[nodiscard]] std::string to_string_old() const;
 
+    /**
+     * Receives consecutive chunks of digits
+     */
+    using digit_sink = std::function<void(std::string_view chunk)>;
+
+    /**
+     * Emits the same characters as `to_string(radix)` to `sink` in order, in chunks of `chunk_size` characters except
+     * for the last one. The divide-and-conquer tree is walked from the top, and the lower halves are converted only when
+     * their turn comes, so no more than a couple of chunks of digits exist at a time.
+     */
+    void write_digits(const digit_sink& sink, int radix = 10, size_t chunk_size = 1 << 16) const;
+    void write_digits(std::ostream& stream, int radix = 10) const;
+
+    /**
+     * Same as `write_digits`, but writes to the file descriptor `fd`, throws `std::system_error` if writing fails
+     */
+    void write_digits_to_fd(int fd, int radix = 10) const;
+
+    /**
+     * Parses a number in the radix from 2 to 36 with an optional leading `-`, letter digits may be in any case.
+     * Throws `std::invalid_argument` if `str` is not a number.
+     */
+    static bint_t from_string(std::string_view str, int radix = 10);
+
+    /**
+     * Parses the longest number in the radix from 2 to 36 with an optional leading `-` at the beginning of
+     * `[first, last)` with the semantics of `std::from_chars`: `value` is not modified if there is no number
+     */
+    static std::from_chars_result from_chars(const char* first, const char* last, bint_t& value, int radix = 10);
+
 private:
-    static constexpr int TO_STRING_THRESHOLD = 20;
-    static std::vector<bint_t> power10_conversion_cache;
+    /**
+     * Writes exactly `digits` digits of `|a|` in `radix` padded with zeroes to `buffer`
+     */
+    static void to_string(const bint_t& a, char* buffer, int digits, int radix);
 
-    static const bint_t& compute_power10_with_cache(int n);
-    static void to_string(const bint_t& a, std::string& buffer, int digits);
+    /**
+     * Value of `length` valid digits in `radix`
+     */
+    static bint_t from_digits(const char* digits, int length, int radix);
+
+    /**
+     * Emits exactly `digits` digits of `a` padded with zeroes, or all digits without leading zeroes if `digits < 0`
+     */
+    static void write_digits(bint_t&& a, int64_t digits, int radix, chunked_digit_writer& writer);
 };
 
+// Operators on temporaries compute the result in the storage of the operand that is about to die
+bint_t operator+(bint_t&& a, const bint_t& b);
+bint_t operator+(const bint_t& a, bint_t&& b);
+bint_t operator+(bint_t&& a, bint_t&& b);
+bint_t operator-(bint_t&& a, const bint_t& b);
+bint_t operator-(const bint_t& a, bint_t&& b);
+bint_t operator-(bint_t&& a, bint_t&& b);
+bint_t operator-(bint_t&& a);
+bint_t operator*(bint_t&& a, const bint_t& b);
+bint_t operator*(const bint_t& a, bint_t&& b);
+bint_t operator*(bint_t&& a, bint_t&& b);
+bint_t operator/(bint_t&& a, const bint_t& b);
+bint_t operator%(bint_t&& a, const bint_t& b);
+bint_t operator<<(bint_t&& a, int64_t n);
+bint_t operator>>(bint_t&& a, int64_t n);
+
 #endif //BIG_INT_H
@@ -6,20 +6,81 @@
 #define BIG_INT_OPS_H
 
 #include "big_int.h"
+#include "thresholds.h"
+
+#include <utility>
 
 namespace big_int {
-    constexpr int KARATSUBA_THRESHOLD = 50;
-    constexpr int KARATSUBA_SQUARE_THRESHOLD = 50;
-    constexpr int TOOM_COOK_THRESHOLD = 220;
-    constexpr int TOOM_COOK_SQUARE_THRESHOLD = 220;
+    /**
+     * Results of the division that the caller needs, the other one is left unspecified and isn't computed
+     * where the algorithm allows it
+     */
+    enum class division_output {
+        quotient_and_remainder,
+        quotient,
+        remainder,
+    };
 
     bint_t add(const bint_t& a, const bint_t& b);
     bint_t sub(const bint_t& a, const bint_t& b);
     bint_t multiply(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
-    void divide_abs(bint_t& a, const bint_t& b, bint_t& rem);
 
-    void divide_knuth_abs(bint_t& a, const bint_t& b, bint_t& rem);
+    /**
+     * `a = |a| / |b|`, `rem = |a| % |b|`
+     */
+    void divide_abs(bint_t& a, const bint_t& b, bint_t& rem,
+                    division_output output = division_output::quotient_and_remainder);
+
+    /**
+     * `{a / b, a % b}` with the semantics of the `bint_t` operators in a single division
+     */
+    std::pair<bint_t, bint_t> divmod(const bint_t& a, const bint_t& b);
+
+    /**
+     * `a / b` for `a` divisible by `b`, much faster than `/` for such operands. The result is meaningless
+     * if the remainder is not zero.
+     */
+    bint_t divexact(const bint_t& a, const bint_t& b);
+
+    /**
+     * Fused multiply-accumulate: `a += b * c` and `a -= b * c` without temporaries for the product of small operands
+     */
+    void addmul(bint_t& a, const bint_t& b, const bint_t& c);
+    void addmul(bint_t& a, const bint_t& b, uint64_t c);
+    void submul(bint_t& a, const bint_t& b, const bint_t& c);
+    void submul(bint_t& a, const bint_t& b, uint64_t c);
+
+    /**
+     * `a = a * b + c`
+     */
+    void muladd(bint_t& a, const bint_t& b, const bint_t& c);
+
+    void divide_knuth_abs(bint_t& a, const bint_t& b, bint_t& rem,
+                          division_output output = division_output::quotient_and_remainder);
     void fast_pow_inplace(bint_t& a, uint64_t n);
+
+    /**
+     * `base^exp mod mod` in `[0, mod)` for `exp >= 0` and `mod > 0`, throws `std::invalid_argument` otherwise.
+     * Odd moduli use the Montgomery multiplication, even ones the Barrett reduction with `bint_divisor`.
+     */
+    bint_t powmod(const bint_t& base, const bint_t& exp, const bint_t& mod);
+
+    /**
+     * Greatest common divisor of `|a|` and `|b|`, `gcd(0, 0) = 0`. Lehmer's algorithm with double-digit steps
+     * for operands shorter than `thresholds_t::hgcd` limbs, the subquadratic half-GCD for longer ones.
+     */
+    bint_t gcd(const bint_t& a, const bint_t& b);
+
+    /**
+     * Returns `g = gcd(a, b)` and the cofactors with `a s + b t = g`. For `b != 0` the cofactor `s` is the one
+     * in `[0, |b| / g)`, for `b = 0` it is the sign of `a` and `t = 0`.
+     */
+    bint_t gcdext(const bint_t& a, const bint_t& b, bint_t& s, bint_t& t);
+
+    /**
+     * `a^(-1) mod mod` in `[0, mod)`, throws `std::invalid_argument` if `mod <= 0` or `a` is not coprime to `mod`
+     */
+    bint_t modinv(const bint_t& a, const bint_t& mod);
     void shift_left_inplace(bint_t& a, int64_t shift);
     void shift_right_inplace(bint_t& a, int64_t shift);
 
@@ -30,13 +91,38 @@ namespace big_int_impl {
     void square(bint_t& a, int a_limit = -1);
     bint_t schoolbook_square(const bint_t& a, int a_limit);
     bint_t schoolbook_multiply(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
+    bint_t multiply_unbalanced(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
     std::strong_ordering compare_abs(const bint_t&a, const bint_t& b, int shift = 0);
     void add_abs_inplace(bint_t& a, const bint_t& b, int b_start = 0, int b_limit = -1, int b_shift = 0, bool let_overflow = false);
     void sub_abs_inplace(bint_t& a, const bint_t& b, int b_limit = -1);
+
+    /**
+     * Signed `a += b` (or `a -= b` if `negate_b`) in the storage of `a`
+     */
+    void add_signed_inplace(bint_t& a, const bint_t& b, bool negate_b = false);
+
+    /**
+     * `a = |b| - |a|`, requires `|a| <= |b|`
+     */
+    void sub_abs_reversed_inplace(bint_t& a, const bint_t& b);
+    void mul_abs_inplace(bint_t& a, uint64_t b);
+
+    /**
+     * `a += (-1)^negative * x * y` for magnitudes `x` and `y`, accumulated row by row straight into `a`.
+     * `x` and `y` must not point into `a`.
+     */
+    void accumulate_product_abs(bint_t& a, const uint64_t* x, int x_size, const uint64_t* y, int y_size, bool negative);
+
     void div_abs_inplace(bint_t& a, uint64_t b, uint64_t& rem);
+
+    /**
+     * `|a| = |a| / b` for `a` divisible by `b`, returns `false` if it is not divisible
+     */
+    bool divexact_abs_inplace(bint_t& a, uint64_t b);
     uint64_t count_bits(const bint_t& a);
     void normalize(bint_t& a);
     bool is_normalized(const bint_t& a);
+    bool is_zero(const bint_t& a);
 }
 
 #endif //BIG_INT_OPS_H
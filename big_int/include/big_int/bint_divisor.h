@@ -0,0 +1,70 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef BINT_DIVISOR_H
+#define BINT_DIVISOR_H
+
+#include "big_int.h"
+#include "big_int_ops.h"
+#include "limbs.h"
+
+#include <memory>
+#include <mutex>
+
+/**
+ * Divisor that is used for many divisions: the normalization shift and the reciprocal are computed once,
+ * so every division of a `2 n`-limb number by the `n`-limb divisor costs about two multiplications
+ * (Barrett reduction). The reciprocal is computed by the first division that uses it, divisors shorter than
+ * `thresholds_t::barrett_division` limbs fall back to `big_int::divide_abs` and never pay for it.
+ * Single-limb divisors use the precomputed reciprocal of the limb.
+ */
+class bint_divisor {
+public:
+    explicit bint_divisor(const bint_t& divisor);
+
+    /**
+     * Absolute value of the divisor
+     */
+    [[nodiscard]] const bint_t& value() const { return divisor; }
+
+    /**
+     * `a = |a| / |d|`, `rem = |a| % |d|`, same as `big_int::divide_abs`
+     */
+    void divide_abs(bint_t& a, bint_t& rem,
+                    big_int::division_output output = big_int::division_output::quotient_and_remainder) const;
+
+    /**
+     * Returns `a / d` and sets `rem = a % d` with the semantics of the `bint_t` operators
+     */
+    bint_t divmod(const bint_t& a, bint_t& rem) const;
+
+    /**
+     * `a % d` with the semantics of the `bint_t` operator
+     */
+    [[nodiscard]] bint_t mod(const bint_t& a) const;
+
+private:
+    /**
+     * `newton_reciprocal(normalized)`, published by the first thread that computes it. The mutex is held only while
+     * the pointer is copied: a thread waiting for another one's computation could be the one that has to run
+     * a part of it from the thread pool.
+     */
+    struct lazy_reciprocal {
+        std::mutex mutex;
+        std::shared_ptr<const bint_t> value;
+    };
+
+    bool sign;
+    bint_t divisor;
+    // `divisor << shift` with the highest bit set, empty for a single-limb divisor
+    bint_t normalized;
+    // Shared by the copies, which have the same divisor, null for a single-limb divisor
+    std::shared_ptr<lazy_reciprocal> reciprocal;
+    int shift;
+    big_int_impl::limb_divisor limb;
+
+    std::shared_ptr<const bint_t> get_reciprocal() const;
+};
+
+#endif //BINT_DIVISOR_H
@@ -6,9 +6,8 @@
 #define BURNIKEL_ZIEGLER_H
 
 #include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
 
-constexpr int BURNIKEL_ZIEGLER_THRESHOLD = 100;
-
-void divide_burnikel_ziegler(bint_t& a, const bint_t& b, bint_t& rem);
+void divide_burnikel_ziegler(bint_t& a, const bint_t& b, bint_t& rem, big_int::division_output output);
 
 #endif //BURNIKEL_ZIEGLER_H
@@ -0,0 +1,29 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef COMBA_H
+#define COMBA_H
+
+#include <cstdint>
+
+/**
+ * Fully unrolled Comba (column-wise) multiplication for small operands: every column of the product is
+ * accumulated in a three-limb accumulator and written once. Kernels are instantiated for every pair of sizes
+ * and picked through a dispatch table.
+ */
+namespace big_int_impl {
+    constexpr int COMBA_MAX_SIZE = 16;
+
+    /**
+     * `r[0..a_size+b_size-1] = a * b`, requires `1 <= a_size, b_size <= COMBA_MAX_SIZE`, `r` must not overlap inputs
+     */
+    void comba_mul(uint64_t* r, const uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * `r[0..2*size-1] = a * a`, requires `1 <= size <= COMBA_MAX_SIZE`, `r` must not overlap `a`
+     */
+    void comba_square(uint64_t* r, const uint64_t* a, int size);
+}
+
+#endif //COMBA_H
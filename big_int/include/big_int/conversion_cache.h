@@ -0,0 +1,49 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef CONVERSION_CACHE_H
+#define CONVERSION_CACHE_H
+
+#include "bint_divisor.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace big_int {
+    /**
+     * Sets the approximate memory budget in bytes of the cached powers `radix^(2^n)` used by the string conversions.
+     * The largest powers are evicted first when the budget is exceeded; conversions that are running keep
+     * the evicted powers alive until they finish. The default is 256 MiB.
+     */
+    void set_conversion_cache_limit(size_t bytes);
+    size_t get_conversion_cache_limit();
+
+    /**
+     * Approximate memory in bytes taken by the cached powers
+     */
+    size_t get_conversion_cache_size();
+
+    /**
+     * Evicts all cached powers
+     */
+    void clear_conversion_cache();
+
+    /**
+     * Computes the powers that are needed to convert numbers of up to `digits` digits in `radix`,
+     * so that the first conversions after the startup don't pay for them
+     */
+    void prewarm_conversion_cache(int radix, int digits);
+}
+
+namespace big_int_impl {
+    /**
+     * Returns `radix^(2^n)` with the precomputed reciprocal, `0 <= n < 32`.
+     * Safe to call from many threads: a cached power is read under the lock of its own entry, a missing one is
+     * computed without locks and then published, so threads that miss it at the same time may compute it twice.
+     * The result stays valid while the pointer is held, even if the power is evicted from the cache.
+     */
+    std::shared_ptr<const bint_divisor> radix_power(int radix, int n);
+}
+
+#endif //CONVERSION_CACHE_H
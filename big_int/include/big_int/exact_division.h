@@ -0,0 +1,18 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef EXACT_DIVISION_H
+#define EXACT_DIVISION_H
+
+#include <big_int/big_int.h>
+
+/**
+ * `|a| = |a| / |b|` for `a` divisible by `b`, the result is meaningless otherwise.
+ * The quotient is computed from the lowest limbs (Hensel division), so only the lowest `size(a) - size(b) + 1` limbs
+ * of the operands are used and no remainder is computed. When both the quotient and the divisor are longer than
+ * `thresholds_t::divexact_via_division`, the subquadratic `big_int::divide_abs` is used instead.
+ */
+void divide_exact(bint_t& a, const bint_t& b);
+
+#endif //EXACT_DIVISION_H
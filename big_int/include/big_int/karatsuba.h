@@ -12,4 +12,9 @@
 bint_t karatsuba(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
 void karatsuba_square(bint_t& a, int a_limit = -1);
 
+void karatsuba_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, int n, uint64_t* scratch);
+void karatsuba_square_n(uint64_t* r, const uint64_t* a, int n, uint64_t* scratch);
+int karatsuba_mul_scratch_size(int n);
+int karatsuba_square_scratch_size(int n);
+
 #endif //KATATSUBA_H
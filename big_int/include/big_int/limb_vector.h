@@ -0,0 +1,281 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef LIMB_VECTOR_H
+#define LIMB_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class bint_mapped_file;
+
+/**
+ * Vector of limbs with the small-buffer optimization: up to `INLINE_CAPACITY` limbs are stored inside the object,
+ * so small numbers don't allocate. Provides the `std::vector` interface that code working with `bint_t::data` relies on
+ * and converts to and from `std::vector<uint64_t>`, new elements are zero-initialized the same way.
+ * `bint_mapped_file` can also make a vector borrow limbs of its mapping.
+ */
+class limb_vector {
+public:
+    using value_type = uint64_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = uint64_t&;
+    using const_reference = const uint64_t&;
+    using pointer = uint64_t*;
+    using const_pointer = const uint64_t*;
+    using iterator = uint64_t*;
+    using const_iterator = const uint64_t*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type INLINE_CAPACITY = 4;
+
+    limb_vector() noexcept = default;
+
+    explicit limb_vector(const size_type size, const uint64_t value = 0) {
+        assign(size, value);
+    }
+
+    limb_vector(const std::initializer_list<uint64_t> values) {
+        assign(values.begin(), values.end());
+    }
+
+    template<std::input_iterator It>
+    limb_vector(const It first, const It last) {
+        assign(first, last);
+    }
+
+    limb_vector(const std::vector<uint64_t>& values) {
+        assign(values.begin(), values.end());
+    }
+
+    limb_vector(const limb_vector& other) {
+        assign(other.begin(), other.end());
+    }
+
+    limb_vector(limb_vector&& other) noexcept {
+        steal(other);
+    }
+
+    ~limb_vector() {
+        release();
+    }
+
+    limb_vector& operator=(const limb_vector& other) {
+        if (this != &other) assign(other.begin(), other.end());
+        return *this;
+    }
+
+    limb_vector& operator=(limb_vector&& other) noexcept {
+        if (this != &other) {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    limb_vector& operator=(const std::initializer_list<uint64_t> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    operator std::vector<uint64_t>() const {
+        return {begin(), end()};
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+    [[nodiscard]] bool is_inline() const noexcept { return ptr == inline_storage; }
+    [[nodiscard]] bool is_borrowed() const noexcept { return capacity_ == 0; }
+
+    uint64_t* data() noexcept { return ptr; }
+    const uint64_t* data() const noexcept { return ptr; }
+
+    uint64_t& operator[](const size_type index) noexcept { return ptr[index]; }
+    const uint64_t& operator[](const size_type index) const noexcept { return ptr[index]; }
+    uint64_t& at(const size_type index) {
+        if (index >= size_) throw std::out_of_range("limb_vector::at: index out of range");
+        return ptr[index];
+    }
+
+    const uint64_t& at(const size_type index) const {
+        if (index >= size_) throw std::out_of_range("limb_vector::at: index out of range");
+        return ptr[index];
+    }
+
+    uint64_t& front() noexcept { return ptr[0]; }
+    const uint64_t& front() const noexcept { return ptr[0]; }
+    uint64_t& back() noexcept { return ptr[size_ - 1]; }
+    const uint64_t& back() const noexcept { return ptr[size_ - 1]; }
+
+    iterator begin() noexcept { return ptr; }
+    const_iterator begin() const noexcept { return ptr; }
+    const_iterator cbegin() const noexcept { return ptr; }
+    iterator end() noexcept { return ptr + size_; }
+    const_iterator end() const noexcept { return ptr + size_; }
+    const_iterator cend() const noexcept { return ptr + size_; }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    void reserve(const size_type capacity) {
+        if (capacity > capacity_) reallocate(capacity);
+    }
+
+    void push_back(const uint64_t value) {
+        if (size_ >= capacity_) reallocate(std::max(size_ + 1, capacity_ * 2));
+        ptr[size_++] = value;
+    }
+
+    void pop_back() noexcept {
+        size_--;
+    }
+
+    void resize(const size_type size, const uint64_t value = 0) {
+        if (size > capacity_) reallocate(std::max(size, capacity_ * 2));
+        if (size > size_) std::fill(ptr + size_, ptr + size, value);
+        size_ = size;
+    }
+
+    void clear() noexcept {
+        size_ = 0;
+    }
+
+    void assign(const size_type size, const uint64_t value) {
+        size_ = 0;
+        resize(size, value);
+    }
+
+    template<std::input_iterator It>
+    void assign(It first, It last) {
+        size_ = 0;
+        if constexpr (std::forward_iterator<It>) {
+            const auto size = static_cast<size_type>(std::distance(first, last));
+            reserve(size);
+            std::copy(first, last, ptr);
+            size_ = size;
+        } else {
+            for (; first != last; ++first) push_back(*first);
+        }
+    }
+
+    iterator insert(const const_iterator position, const uint64_t value) {
+        return insert(position, 1, value);
+    }
+
+    iterator insert(const const_iterator position, const size_type count, const uint64_t value) {
+        uint64_t* gap = make_gap(position - ptr, count);
+        std::fill_n(gap, count, value);
+        return gap;
+    }
+
+    template<std::input_iterator It>
+    iterator insert(const const_iterator position, const It first, const It last) {
+        // The inserted range may point into this vector, so it is copied before the limbs are shifted
+        const limb_vector values(first, last);
+        uint64_t* gap = make_gap(position - ptr, values.size());
+        std::copy(values.begin(), values.end(), gap);
+        return gap;
+    }
+
+    iterator erase(const const_iterator position) {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const const_iterator first, const const_iterator last) {
+        const size_type offset = first - ptr;
+        const size_type count = last - first;
+        if (count > 0) {
+            reserve(size_);
+            std::copy(ptr + offset + count, ptr + size_, ptr + offset);
+            size_ -= count;
+        }
+        return ptr + offset;
+    }
+
+    void swap(limb_vector& other) noexcept {
+        limb_vector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend bool operator==(const limb_vector& a, const limb_vector& b) noexcept {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    friend class bint_mapped_file;
+
+    uint64_t* ptr = inline_storage;
+    size_type size_ = 0;
+    size_type capacity_ = INLINE_CAPACITY;
+    uint64_t inline_storage[INLINE_CAPACITY];
+
+    /**
+     * Vector that refers to `size` limbs owned by someone else. Borrowed limbs are read-only, so only `bint_mapped_file`
+     * makes such vectors and hands them out as `const`: they may only be read, copied (the copy owns its limbs),
+     * moved and destroyed. Growing one copies its limbs into an owned buffer first.
+     */
+    static limb_vector borrow(const uint64_t* data, const size_type size) noexcept {
+        limb_vector result;
+        result.ptr = const_cast<uint64_t*>(data);
+        result.size_ = size;
+        result.capacity_ = 0;
+        return result;
+    }
+
+    void reallocate(const size_type capacity) {
+        uint64_t* new_ptr = std::allocator<uint64_t>().allocate(capacity);
+        std::copy_n(ptr, size_, new_ptr);
+        release();
+        ptr = new_ptr;
+        capacity_ = capacity;
+    }
+
+    /**
+     * Shifts the limbs starting from `offset` by `count` positions to the end, returns the pointer to the gap
+     */
+    uint64_t* make_gap(const size_type offset, const size_type count) {
+        if (size_ + count > capacity_) reallocate(std::max(size_ + count, capacity_ * 2));
+        std::copy_backward(ptr + offset, ptr + size_, ptr + size_ + count);
+        size_ += count;
+        return ptr + offset;
+    }
+
+    void release() noexcept {
+        if (!is_inline() && !is_borrowed()) std::allocator<uint64_t>().deallocate(ptr, capacity_);
+        ptr = inline_storage;
+        capacity_ = INLINE_CAPACITY;
+    }
+
+    /**
+     * Takes the heap or borrowed buffer of `other` or copies its inline limbs, leaves `other` empty
+     */
+    void steal(limb_vector& other) noexcept {
+        if (other.is_inline()) {
+            std::copy_n(other.inline_storage, other.size_, inline_storage);
+            ptr = inline_storage;
+            capacity_ = INLINE_CAPACITY;
+        } else {
+            ptr = other.ptr;
+            capacity_ = other.capacity_;
+            other.ptr = other.inline_storage;
+            other.capacity_ = INLINE_CAPACITY;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+};
+
+#endif //LIMB_VECTOR_H
@@ -0,0 +1,181 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef LIMBS_H
+#define LIMBS_H
+
+#include "big_int.h"
+
+#include <bit>
+#include <cstdint>
+
+/**
+ * Low-level operations on non-owning ranges of little-endian limbs (pointer + size).
+ * Recursive multiplication algorithms work on these ranges and a preallocated scratch buffer,
+ * so they don't allocate on every level of the recursion.
+ * Unless stated otherwise, output ranges may coincide with input ranges, but must not partially overlap them.
+ */
+namespace big_int_impl {
+    /**
+     * `r[0..a_size-1] = a + b`, requires `a_size >= b_size`, returns the carry
+     */
+    uint64_t limbs_add(uint64_t* r, const uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * `r[0..a_size-1] = a - b`, requires `a_size >= b_size`, returns the borrow
+     */
+    uint64_t limbs_sub(uint64_t* r, const uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * Adds `b` to `a[0..a_size-1]` and propagates the carry, returns the carry out of `a`
+     */
+    uint64_t limbs_add_inplace(uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * Subtracts `b` from `a[0..a_size-1]` and propagates the borrow, returns the borrow out of `a`
+     */
+    uint64_t limbs_sub_inplace(uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * Compares `a` and `b` as if the shorter one was padded with zeroes
+     */
+    int limbs_compare(const uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * `r[0..max(a_size, b_size)-1] = |a - b|`, returns `true` if `a < b`
+     */
+    bool limbs_abs_diff(uint64_t* r, const uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * Signed addition in the sign-magnitude form: `r = (-1)^a_neg * a + (-1)^b_neg * b`,
+     * `a` and `r` have `size` limbs, requires `size >= b_size`. Returns the sign of `r`.
+     */
+    bool limbs_add_signed(uint64_t* r, const uint64_t* a, bool a_neg, const uint64_t* b, int b_size, bool b_neg, int size);
+
+    /**
+     * `r = a << shift`, requires `0 < shift < 64`, returns the bits shifted out of the highest limb
+     */
+    uint64_t limbs_shift_left(uint64_t* r, const uint64_t* a, int size, int shift);
+
+    /**
+     * `r = a >> shift`, requires `0 < shift < 64`, returns the bits shifted out of the lowest limb
+     */
+    uint64_t limbs_shift_right(uint64_t* r, const uint64_t* a, int size, int shift);
+
+    /**
+     * Divisor by an invariant word with the precomputed reciprocal (Möller, Granlund, "Improved division by invariant
+     * integers"): every 2-by-1 division costs two multiplications instead of the hardware 128-bit division
+     */
+    struct limb_divisor {
+        uint64_t divisor;
+        uint64_t normalized;    // `divisor << shift`, the highest bit is set
+        uint64_t reciprocal;    // floor((2^128 - 1) / normalized) - 2^64
+        int shift;
+
+        explicit limb_divisor(const uint64_t divisor)
+            : divisor(divisor), normalized(divisor << std::countl_zero(divisor)),
+              reciprocal(static_cast<uint64_t>(~static_cast<__uint128_t>(0) / normalized)),
+              shift(std::countl_zero(divisor)) {}
+
+        /**
+         * Returns `(high * 2^64 + low) / normalized` and stores the remainder in `rem`, requires `high < normalized`
+         */
+        uint64_t divide_normalized(const uint64_t high, const uint64_t low, uint64_t& rem) const {
+            const __uint128_t estimate = static_cast<__uint128_t>(reciprocal) * high
+                + (static_cast<__uint128_t>(high) << 64 | low);
+            auto quotient = static_cast<uint64_t>(estimate >> 64) + 1;
+            uint64_t r = low - quotient * normalized;
+            // Branch-free adjustment, this condition is unpredictable
+            const uint64_t mask = -static_cast<uint64_t>(r > static_cast<uint64_t>(estimate));
+            quotient += mask;
+            r += mask & normalized;
+            if (r >= normalized) [[unlikely]] {
+                quotient++;
+                r -= normalized;
+            }
+            rem = r;
+            return quotient;
+        }
+    };
+
+    /**
+     * `r = a / b`, returns the remainder
+     */
+    uint64_t limbs_div_1(uint64_t* r, const uint64_t* a, int size, uint64_t b);
+    uint64_t limbs_div_1(uint64_t* r, const uint64_t* a, int size, const limb_divisor& b);
+
+    /**
+     * `b^(-1) mod 2^64` for an odd `b`, every Newton step `x = x (2 - b x)` doubles the number of correct bits
+     */
+    constexpr uint64_t limb_inverse(const uint64_t b) {
+        uint64_t x = b; // b * b = 1 mod 8, so 3 bits are correct
+        for (int i = 0; i < 5; i++) {
+            x *= 2 - b * x;
+        }
+        return x;
+    }
+
+    /**
+     * `r = a / b` for `a` divisible by `b`, processed from the lowest limb with multiplications by `b^(-1) mod 2^64`
+     * (Jebelean's exact division), no 128-bit divisions are needed. Returns zero if `a` is divisible by `b`,
+     * otherwise `r` is meaningless and the result is not zero.
+     */
+    uint64_t limbs_divexact_1(uint64_t* r, const uint64_t* a, int size, uint64_t b);
+
+    /**
+     * `r = a / b^count` in a single pass: the quotient limbs of every division feed the next one as soon as
+     * they are produced, so the chains of dependent multiplications overlap. Remainders are stored to `rems`,
+     * the first one is the lowest. `b` must be normalized.
+     */
+    void limbs_div_1_chained(uint64_t* r, const uint64_t* a, int size, const limb_divisor& b, uint64_t* rems, int count);
+
+    /**
+     * `r[0..n-1] = a * b`, returns the high limb of the product
+     */
+    uint64_t limbs_mul_1(uint64_t* r, const uint64_t* a, int n, uint64_t b);
+
+    /**
+     * `r[0..n-1] += a * b`, returns the carry limb
+     */
+    uint64_t limbs_addmul_1(uint64_t* r, const uint64_t* a, int n, uint64_t b);
+
+    /**
+     * `r[0..n-1] -= a * b`, returns the borrow limb
+     */
+    uint64_t limbs_submul_1(uint64_t* r, const uint64_t* a, int n, uint64_t b);
+
+    /**
+     * `r[0..a_size+b_size-1] = a * b`, `r` must not overlap inputs
+     */
+    void limbs_mul_basecase(uint64_t* r, const uint64_t* a, int a_size, const uint64_t* b, int b_size);
+
+    /**
+     * `r[0..2*size-1] = a * a`, `r` must not overlap `a`
+     */
+    void limbs_square_basecase(uint64_t* r, const uint64_t* a, int size);
+
+    /**
+     * `r[0..2*n-1] = a * b` for operands of the same size `n`. Chooses between schoolbook, Karatsuba and Toom-3.
+     * `scratch` must hold at least `limbs_mul_scratch_size(n)` limbs, `r` must not overlap inputs or `scratch`.
+     */
+    void limbs_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, int n, uint64_t* scratch);
+    void limbs_square_n(uint64_t* r, const uint64_t* a, int n, uint64_t* scratch);
+
+    int limbs_mul_scratch_size(int n);
+    int limbs_square_scratch_size(int n);
+
+    /**
+     * Same as `limbs_mul_n` and `limbs_square_n`, but allocate their own scratch,
+     * so that several products of one recursion level can run in parallel
+     */
+    void limbs_mul_n_alloc(uint64_t* r, const uint64_t* a, const uint64_t* b, int n);
+    void limbs_square_n_alloc(uint64_t* r, const uint64_t* a, int n);
+
+    /**
+     * Returns limbs of `a[0..a_limit-1]`, copied into `buffer` and padded with zeroes up to `n` if `a_limit < n`
+     */
+    const uint64_t* limbs_padded(const bint_t& a, int a_limit, int n, uint64_t* buffer);
+}
+
+#endif //LIMBS_H
@@ -0,0 +1,28 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef LIMBS_X86_64_H
+#define LIMBS_X86_64_H
+
+#include <cstdint>
+
+#if defined(__x86_64__)
+
+/**
+ * x86-64 kernels of `limbs_mul_1`, `limbs_addmul_1` and `limbs_submul_1` written with BMI2 `mulx`
+ * and two independent ADX carry chains (`adcx` for high halves of products, `adox` for the accumulator).
+ * They are not compiled with `-mbmi2 -madx`, so the binary runs everywhere, but must be called
+ * only if `cpu_supports_mulx_adx()` returns `true`.
+ */
+namespace big_int_impl {
+    bool cpu_supports_mulx_adx();
+
+    uint64_t limbs_mul_1_adx(uint64_t* r, const uint64_t* a, int n, uint64_t b);
+    uint64_t limbs_addmul_1_adx(uint64_t* r, const uint64_t* a, int n, uint64_t b);
+    uint64_t limbs_submul_1_adx(uint64_t* r, const uint64_t* a, int n, uint64_t b);
+}
+
+#endif
+
+#endif //LIMBS_X86_64_H
@@ -0,0 +1,31 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef NEWTON_DIVISION_H
+#define NEWTON_DIVISION_H
+
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+
+/**
+ * Approximation of `2^(128 n) / b` for an `n`-limb `b` with the highest bit set, the error is at most a few units.
+ * Computed with the Newton iteration `x = x + x * (2^(128 n) - b * x) / 2^(128 n)`, which doubles the number
+ * of correct limbs on every step, so the cost is a constant multiple of one multiplication.
+ */
+bint_t newton_reciprocal(const bint_t& b);
+
+/**
+ * `a = a / b`, `rem = a % b` for a non-negative `a` and a normalized `b` with its reciprocal `x = newton_reciprocal(b)`.
+ * Every `n`-limb block of the quotient is estimated with one multiplication by `x` and fixed with one more.
+ */
+void divide_with_reciprocal(bint_t& a, const bint_t& b, const bint_t& x, bint_t& rem,
+                            big_int::division_output output = big_int::division_output::quotient_and_remainder);
+
+/**
+ * Division of absolute values via the reciprocal of `b`: every `n`-limb block of the quotient costs
+ * two multiplications of `n`-limb numbers, where `n` is the size of `b`
+ */
+void divide_newton(bint_t& a, const bint_t& b, bint_t& rem, big_int::division_output output);
+
+#endif //NEWTON_DIVISION_H
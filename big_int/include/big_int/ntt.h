@@ -0,0 +1,19 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef NTT_H
+#define NTT_H
+
+#include "big_int.h"
+
+bint_t ntt_multiply(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
+void ntt_square(bint_t& a, int a_limit = -1);
+
+/**
+ * `|a * b| mod (2^(64 n) - 1)` for a power of two `n` with a single cyclic convolution of size `n`:
+ * limbs of the product above `n` wrap around. Both operands must fit in `n` limbs.
+ */
+bint_t ntt_multiply_wrapped(const bint_t& a, const bint_t& b, int n);
+
+#endif //NTT_H
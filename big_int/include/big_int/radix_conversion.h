@@ -0,0 +1,55 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef RADIX_CONVERSION_H
+#define RADIX_CONVERSION_H
+
+#include <big_int/big_int.h>
+
+#include <array>
+#include <cstdint>
+
+/**
+ * Digits of the radixes up to 36, the output is lowercase
+ */
+constexpr char radix_digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+namespace big_int_impl {
+    inline constexpr auto radix_digit_values = [] {
+        std::array<uint8_t, 256> values{};
+        values.fill(255);
+        for (int i = 0; i < 36; i++) {
+            values[static_cast<uint8_t>(radix_digit_chars[i])] = i;
+            if (i >= 10) values[static_cast<uint8_t>(radix_digit_chars[i] - 'a' + 'A')] = i;
+        }
+        return values;
+    }();
+}
+
+/**
+ * Value of the digit `c` in the radixes up to 36 in any case, 36 or more if `c` is not a digit
+ */
+inline int radix_digit_value(const char c) {
+    return big_int_impl::radix_digit_values[static_cast<uint8_t>(c)];
+}
+
+/**
+ * Writes exactly 19 decimal digits of `group < 10^19` padded with zeroes to `buffer`
+ */
+void write_decimal_group(char* buffer, uint64_t group);
+
+/**
+ * Writes exactly `digits` digits of `|a|` in the radix `2^bits_per_digit` padded with zeroes to `buffer`.
+ * Every digit is a slice of the bits of `a`, so the conversion takes linear time; hexadecimal digits
+ * are produced for a whole limb at once with word operations.
+ */
+void power2_radix_to_string(const bint_t& a, char* buffer, int digits, int bits_per_digit);
+
+/**
+ * Value of `length` valid digits in the radix `2^bits_per_digit`, the bits of the digits are packed into
+ * limbs in linear time
+ */
+bint_t power2_radix_from_digits(const char* digits, int length, int bits_per_digit);
+
+#endif //RADIX_CONVERSION_H
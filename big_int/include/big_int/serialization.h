@@ -0,0 +1,55 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include "big_int.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/**
+ * Binary format of a number: 16-byte header followed by the raw little-endian limbs, so the limbs of a memory-mapped
+ * file are aligned. The header is the magic `"BINT"`, the 16-bit format version, the sign byte (1 for negative numbers),
+ * a reserved zero byte and the 64-bit number of limbs. Limbs are normalized, zero is stored as a single zero limb.
+ */
+namespace big_int {
+    constexpr uint16_t binary_format_version = 1;
+
+    void write_binary(std::ostream& output, const bint_t& a);
+    void save_binary(const std::string& path, const bint_t& a);
+
+    /**
+     * Throws `std::runtime_error` if the input is not a number in the binary format or is truncated
+     */
+    bint_t read_binary(std::istream& input);
+    bint_t load_binary(const std::string& path);
+}
+
+/**
+ * Number in a file in the binary format, mapped into memory read-only. `value()` borrows the limbs of the mapping,
+ * so it can be passed to any function that takes `const bint_t&` without copying them; pages are read from the disk
+ * as the limbs are accessed. The value must not be used after the view is destroyed.
+ */
+class bint_mapped_file {
+public:
+    explicit bint_mapped_file(const std::string& path);
+    ~bint_mapped_file();
+
+    bint_mapped_file(bint_mapped_file&& other) noexcept;
+    bint_mapped_file(const bint_mapped_file&) = delete;
+    bint_mapped_file& operator=(const bint_mapped_file&) = delete;
+    bint_mapped_file& operator=(bint_mapped_file&&) = delete;
+
+    [[nodiscard]] const bint_t& value() const { return number; }
+
+private:
+    void* mapping;
+    size_t length;
+    bint_t number;
+};
+
+#endif //SERIALIZATION_H
@@ -0,0 +1,108 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace big_int {
+    /**
+     * Sets the number of threads used by the parallel multiplication, including the calling thread.
+     * `threads <= 1` disables parallelism (default). Must not be called while another thread multiplies numbers.
+     */
+    void set_thread_count(int threads);
+    int get_thread_count();
+
+    /**
+     * Sets the minimal operand size in limbs, starting from which sub-products of the recursive algorithms
+     * are computed in parallel
+     */
+    void set_parallel_threshold(int limbs);
+    int get_parallel_threshold();
+}
+
+namespace big_int_impl {
+    /**
+     * Work-stealing thread pool: every worker has its own deque of tasks, takes new tasks from its back
+     * and steals the oldest tasks from the front of other deques when its own deque is empty.
+     * Threads waiting for their tasks help executing pending tasks instead of blocking.
+     */
+    class thread_pool {
+    public:
+        explicit thread_pool(int workers);
+        ~thread_pool();
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        void submit(std::function<void()> task);
+
+        /**
+         * Executes one pending task if there is any, returns `false` otherwise
+         */
+        bool try_run_one();
+
+    private:
+        struct worker_queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<worker_queue>> queues;
+        std::vector<std::thread> threads;
+        std::mutex sleep_mutex;
+        std::condition_variable sleep_condition;
+        std::atomic<int> pending = 0;
+        std::atomic<unsigned> next_queue = 0;
+        bool stopping = false;
+
+        bool try_pop(int queue_index, bool from_back, std::function<void()>& task);
+        void worker_loop(int index);
+    };
+
+    /**
+     * Set of tasks on the global thread pool that can be waited for together.
+     * The first exception thrown by a task is rethrown from `wait`.
+     */
+    class task_group {
+    public:
+        explicit task_group(thread_pool& pool) : pool(pool) {}
+        ~task_group();
+
+        void run(std::function<void()> task);
+        void wait();
+
+    private:
+        thread_pool& pool;
+        std::atomic<int> pending = 0;
+        std::mutex exception_mutex;
+        std::exception_ptr exception;
+    };
+
+    /**
+     * Returns the global thread pool if the parallel mode is enabled and `n >= get_parallel_threshold()`
+     */
+    thread_pool* parallel_pool(int n);
+
+    /**
+     * Runs all `tasks` in parallel on `pool` and waits for them
+     */
+    template<typename... Tasks>
+    void parallel_invoke(thread_pool& pool, Tasks&&... tasks) {
+        task_group group(pool);
+        (group.run(std::forward<Tasks>(tasks)), ...);
+        group.wait();
+    }
+}
+
+#endif //THREAD_POOL_H
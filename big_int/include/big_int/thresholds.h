@@ -0,0 +1,69 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef THRESHOLDS_H
+#define THRESHOLDS_H
+
+#include <iosfwd>
+#include <string>
+
+namespace big_int {
+    /**
+     * Operand sizes in limbs, starting from which the corresponding algorithm is used.
+     * Defaults are tuned on one machine, `tune_thresholds` finds the best values for the local CPU.
+     */
+    struct thresholds_t {
+        int karatsuba = 50;
+        int karatsuba_square = 50;
+        int toom_cook = 220;
+        int toom_cook_square = 220;
+        int toom_4 = 1000;
+        int toom_4_square = 1500;
+        int toom_6h = 2000;
+        int toom_6h_square = 3000;
+        int ntt = 10000;
+        int ntt_square = 14000;
+        int burnikel_ziegler = 100;
+        // Divisor size for the Newton reciprocal division, it wins earlier when the dividend is much longer than the divisor
+        int newton_division = 40000;
+        // Divisor size for the division with the reciprocal precomputed by `bint_divisor`
+        int barrett_division = 200;
+        // Size of both the quotient and the divisor, starting from which `divexact` uses the division with the remainder
+        int divexact_via_division = 1700;
+        int to_string = 20;
+        int from_string = 500;
+        // Operand size for the half-GCD, shorter operands are reduced by Lehmer steps
+        int hgcd = 150;
+
+        // Minimal ratios of the larger operand size to the smaller one for unbalanced multiplication strategies
+        double toom_32_ratio = 1.4;
+        double toom_42_ratio = 1.9;
+        double unbalanced_slice_ratio = 2.8;
+    };
+
+    /**
+     * Name of the environment variable with a path to the thresholds file, which is loaded on startup.
+     * If the file can't be loaded, a warning is printed to stderr and the defaults are used.
+     */
+    constexpr auto THRESHOLDS_ENV_VARIABLE = "FAST_MATH_THRESHOLDS";
+
+    const thresholds_t& get_thresholds();
+
+    /**
+     * Replaces the current thresholds, throws `std::invalid_argument` if some values are out of range.
+     * Must not be called while another thread uses the library.
+     */
+    void set_thresholds(const thresholds_t& thresholds);
+
+    /**
+     * Reads thresholds in the `name = value` format, one per line, `#` starts a comment.
+     * Missing names keep their values from `base`.
+     */
+    thresholds_t read_thresholds(std::istream& input, const thresholds_t& base = {});
+    thresholds_t load_thresholds(const std::string& path, const thresholds_t& base = {});
+
+    void write_thresholds(std::ostream& output, const thresholds_t& thresholds);
+}
+
+#endif //THRESHOLDS_H
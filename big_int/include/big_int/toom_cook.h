@@ -10,4 +10,28 @@
 bint_t toom3(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
 void toom3_square(bint_t& a, int a_limit = -1);
 
+void toom3_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, int n, uint64_t* scratch);
+void toom3_square_n(uint64_t* r, const uint64_t* a, int n, uint64_t* scratch);
+int toom3_mul_scratch_size(int n);
+int toom3_square_scratch_size(int n);
+
+bint_t toom4(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
+void toom4_square(bint_t& a, int a_limit = -1);
+
+void toom4_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, int n, uint64_t* scratch);
+void toom4_square_n(uint64_t* r, const uint64_t* a, int n, uint64_t* scratch);
+int toom4_mul_scratch_size(int n);
+int toom4_square_scratch_size(int n);
+
+bint_t toom6h(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
+void toom6h_square(bint_t& a, int a_limit = -1);
+
+void toom6h_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, int n, uint64_t* scratch);
+void toom6h_square_n(uint64_t* r, const uint64_t* a, int n, uint64_t* scratch);
+int toom6h_mul_scratch_size(int n);
+int toom6h_square_scratch_size(int n);
+
+bint_t toom32(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
+bint_t toom42(const bint_t& a, const bint_t& b, int a_limit = -1, int b_limit = -1);
+
 #endif //TOOM_COOK_H
@@ -4,8 +4,19 @@
 
 #include "big_int/big_int.h"
 #include "big_int/big_int_ops.h"
+#include "big_int/conversion_cache.h"
+#include "big_int/limbs.h"
+#include "big_int/radix_conversion.h"
+#include "big_int/thread_pool.h"
 
-std::vector<bint_t> bint_t::power10_conversion_cache = {bint_t(10)};
+#include <bit>
+#include <cerrno>
+#include <cmath>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+
+#include <unistd.h>
 
 bint_t::bint_t() : sign(false) {}
 
@@ -16,7 +27,7 @@ bint_t::bint_t(const uint64_t value) : sign(false) {
 }
 
 bint_t::bint_t(const int64_t value) : sign(value < 0) {
-    data.push_back(abs(value));
+    data.push_back(value < 0 ? -static_cast<uint64_t>(value) : value);
 }
 
 bint_t::bint_t(const int value) : bint_t(static_cast<int64_t>(value)) {}
@@ -43,6 +54,7 @@ bool bint_t::operator==(const bint_t& other) const {
 bint_t bint_t::operator-() const {
     auto result = *this;
     result.sign = !result.sign;
+    big_int_impl::normalize(result);
     return result;
 }
 
@@ -66,16 +78,8 @@ bint_t bint_t::operator/(const bint_t& other) const {
 
 bint_t bint_t::operator%(const bint_t& other) const {
     bint_t a = *this;
-    bint_t rem;
-    big_int::divide_abs(a, other, rem);
-    if (rem == bint_t(0ll)) return rem;
-    if (this->sign != other.sign) {
-        const bint_t r = rem;
-        rem = other;
-        big_int_impl::sub_abs_inplace(rem, r);
-    }
-    rem.sign = other.sign;
-    return rem;
+    a %= other;
+    return a;
 }
 
 bint_t bint_t::operator<<(const int64_t n) const {
@@ -91,11 +95,13 @@ bint_t bint_t::operator>>(const int64_t n) const {
 }
 
 bint_t& bint_t::operator+=(const bint_t& other) {
-    return *this = *this + other;
+    big_int_impl::add_signed_inplace(*this, other);
+    return *this;
 }
 
 bint_t& bint_t::operator-=(const bint_t& other) {
-    return *this = *this - other;
+    big_int_impl::add_signed_inplace(*this, other, true);
+    return *this;
 }
 
 bint_t& bint_t::operator*=(const bint_t& other) {
@@ -104,34 +110,43 @@ bint_t& bint_t::operator*=(const bint_t& other) {
         return *this;
     }
 
+    if (other.data.size() == 1) {
+        this->sign = this->sign ^ other.sign;
+        big_int_impl::mul_abs_inplace(*this, other.data[0]);
+        return *this;
+    }
+
     return *this = *this * other;
 }
 
 bint_t& bint_t::operator/=(const bint_t& other) {
+    const bool negative = this->sign ^ other.sign;
     bint_t rem;
-    big_int::divide_abs(*this, other, rem);
-    this->sign = this->sign ^ other.sign;
-    if (this->sign && rem != bint_t(0ll)) {
+    // The remainder is needed only to round a negative quotient down
+    big_int::divide_abs(*this, other, rem,
+                        negative ? big_int::division_output::quotient_and_remainder : big_int::division_output::quotient);
+    if (negative && !big_int_impl::is_zero(rem)) {
         big_int_impl::add_abs_inplace(*this, bint_t(1ll));
     }
+    this->sign = negative;
+    big_int_impl::normalize(*this);
     return *this;
 }
 
 bint_t& bint_t::operator%=(const bint_t& other) {
+    const bool sign = this->sign;
     bint_t rem;
-    big_int::divide_abs(*this, other, rem);
-    if (rem == bint_t(0ll)) {
-        *this = bint_t(0);
+    big_int::divide_abs(*this, other, rem, big_int::division_output::remainder);
+    if (big_int_impl::is_zero(rem)) {
+        *this = std::move(rem);
         return *this;
     }
 
-    if (this->sign != other.sign) {
-        *this = other;
-        big_int_impl::sub_abs_inplace(*this, rem);
-    } else {
-        *this = rem;
+    if (sign != other.sign) {
+        big_int_impl::sub_abs_reversed_inplace(rem, other);
     }
-    this->sign = other.sign;
+    rem.sign = other.sign;
+    *this = std::move(rem);
     return *this;
 }
 
@@ -145,80 +160,448 @@ bint_t& bint_t::operator>>=(const int64_t n) {
     return *this;
 }
 
-void small_to_string(const bint_t& a, std::string& buffer, const int digits) {
+bint_t operator+(bint_t&& a, const bint_t& b) {
+    a += b;
+    return std::move(a);
+}
+
+bint_t operator+(const bint_t& a, bint_t&& b) {
+    b += a;
+    return std::move(b);
+}
+
+bint_t operator+(bint_t&& a, bint_t&& b) {
+    return std::move(a) + b;
+}
+
+bint_t operator-(bint_t&& a, const bint_t& b) {
+    a -= b;
+    return std::move(a);
+}
+
+bint_t operator-(const bint_t& a, bint_t&& b) {
+    // `a` may be the same object as `b`, so it is not negated before it is read
+    b -= a;
+    return -std::move(b);
+}
+
+bint_t operator-(bint_t&& a, bint_t&& b) {
+    return std::move(a) - b;
+}
+
+bint_t operator-(bint_t&& a) {
+    a.sign = !a.sign;
+    big_int_impl::normalize(a);
+    return std::move(a);
+}
+
+bint_t operator*(bint_t&& a, const bint_t& b) {
+    a *= b;
+    return std::move(a);
+}
+
+bint_t operator*(const bint_t& a, bint_t&& b) {
+    b *= a;
+    return std::move(b);
+}
+
+bint_t operator*(bint_t&& a, bint_t&& b) {
+    return std::move(a) * b;
+}
+
+bint_t operator/(bint_t&& a, const bint_t& b) {
+    a /= b;
+    return std::move(a);
+}
+
+bint_t operator%(bint_t&& a, const bint_t& b) {
+    a %= b;
+    return std::move(a);
+}
+
+bint_t operator<<(bint_t&& a, const int64_t n) {
+    a <<= n;
+    return std::move(a);
+}
+
+bint_t operator>>(bint_t&& a, const int64_t n) {
+    a >>= n;
+    return std::move(a);
+}
+
+/**
+ * The largest power of the radix that fits into a limb: groups of `digits` digits are converted with word operations
+ */
+struct digit_group {
+    int digits;
+    big_int_impl::limb_divisor divisor;
+};
+
+const digit_group& get_digit_group(const int radix) {
+    static const std::vector<digit_group> groups = [] {
+        std::vector<digit_group> result;
+        for (int r = 0; r <= 36; r++) {
+            int digits = 0;
+            uint64_t value = 1;
+            while (r >= 2 && value <= UINT64_MAX / r) {
+                value *= r;
+                digits++;
+            }
+            result.push_back({digits, big_int_impl::limb_divisor(value)});
+        }
+        return result;
+    }();
+    return groups[radix];
+}
+
+double digits_per_limb(const int radix) {
+    return 64 / std::log2(radix);
+}
+
+/**
+ * Writes `count` lowest digits of `group` right to left, ending before `end`
+ */
+inline char* write_group_digits(char* end, uint64_t group, const int count, const int radix) {
+    for (int j = 0; j < count; j++) {
+        *--end = radix_digit_chars[group % radix];
+        group /= radix;
+    }
+    return end;
+}
+
+void small_to_string(const bint_t& a, char* buffer, const int digits, const int radix) {
+    const digit_group& group = get_digit_group(radix);
+    // Divisors with the highest bit set, like 10^19, are used without shifts in chains of divisions
+    const int chain = group.divisor.shift == 0 ? 4 : 1;
+
     std::vector<uint64_t> groups;
     bint_t current = a;
-    uint64_t rem;
-
-    groups.reserve(std::ceil(static_cast<double>(current.data.size()) * 64 / std::log2(10) / 19));
+    groups.reserve(std::ceil(current.data.size() * digits_per_limb(radix) / group.digits) + chain);
     while (current.data.size() > 1 || (!current.data.empty() && current.data[0] != 0ull)) { // while current != 0
-        constexpr uint64_t divisor = 10000000000000000000ull;
-        big_int_impl::div_abs_inplace(current, divisor, rem);
-        groups.push_back(rem);
-    }
-
-    constexpr int digits_per_group = 19;
-    if (digits > 0) {
-        const auto& last_group = std::to_string(groups.back());
-        const int total_digits = (groups.size() - 1) * digits_per_group + last_group.length();
-        if (total_digits > digits) {
-            throw std::runtime_error("small_to_string: result.size()[" + std::to_string(total_digits) +
-                "] > digits[" + std::to_string(digits) + "]");
+        // Several groups per pass over `current`, the quotient loses almost a limb on every division
+        uint64_t rems[4];
+        const int count = std::min<int>(chain, current.data.size());
+        if (chain == 1) {
+            rems[0] = big_int_impl::limbs_div_1(current.data.data(), current.data.data(), current.data.size(), group.divisor);
+        } else {
+            big_int_impl::limbs_div_1_chained(current.data.data(), current.data.data(), current.data.size(), group.divisor, rems, count);
         }
-        buffer.append(digits - total_digits, '0');
-        buffer.append(last_group);
-    } else {
-        buffer.append(std::to_string(groups.back()));
+        groups.insert(groups.end(), rems, rems + count);
+        big_int_impl::normalize(current);
+    }
+    // The last pass can produce zero groups above the highest digit
+    while (groups.size() > 1 && groups.back() == 0) {
+        groups.pop_back();
+    }
+    if (groups.empty()) groups.push_back(0);
+
+    int last_group_digits = 0;
+    for (uint64_t value = groups.back(); value != 0; value /= radix) last_group_digits++;
+    const int total_digits = (groups.size() - 1) * group.digits + last_group_digits;
+    if (total_digits > digits) {
+        throw std::runtime_error("small_to_string: result.size()[" + std::to_string(total_digits) +
+            "] > digits[" + std::to_string(digits) + "]");
     }
 
-    for (int i = groups.size() - 2; i >= 0; i--) {
-        auto sgroup = std::to_string(groups[i]);
-        buffer.append(digits_per_group - sgroup.length(), '0');
-        buffer.append(sgroup);
+    // Groups are written from the lowest one, right to left
+    char* end = buffer + digits;
+    for (int i = 0; i < groups.size(); i++) {
+        const int group_digits = i + 1 < groups.size() ? group.digits : last_group_digits;
+        if (radix == 10 && end - buffer >= group.digits) {
+            // Whole groups are formatted without divisions by 10, the zeroes of the highest one are overwritten below
+            end -= group.digits;
+            write_decimal_group(end, groups[i]);
+            end += group.digits - group_digits;
+        } else {
+            end = write_group_digits(end, groups[i], group_digits, radix);
+        }
     }
+    std::fill(buffer, end, '0');
 }
 
-const bint_t& bint_t::compute_power10_with_cache(const int n) {
-    if (n < power10_conversion_cache.size())
-        return power10_conversion_cache[n];
-
-    const int old_size = power10_conversion_cache.size();
-    power10_conversion_cache.resize(n + 1);
-    for (int i = old_size; i <= n; i++) {
-        bint_t next_value = power10_conversion_cache[i - 1];
-        next_value *= next_value;
-        power10_conversion_cache[i] = next_value;
-    }
-    return power10_conversion_cache[n];
+/**
+ * `n`, such as radix^(2^(n + 1)) is approximately `a`
+ */
+int radix_power_split_index(const bint_t& a, const int radix) {
+    return static_cast<int>(std::round(
+        std::log2(static_cast<double>(big_int_impl::count_bits(a)) / std::log2(radix)) - 1
+    ));
 }
 
-void bint_t::to_string(const bint_t& a, std::string& buffer, const int digits) { // NOLINT(*-no-recursion)
-    if (a.data.size() < TO_STRING_THRESHOLD)
-        return small_to_string(a, buffer, digits);
+void bint_t::to_string(const bint_t& a, char* buffer, const int digits, const int radix) { // NOLINT(*-no-recursion)
+    if (a.data.size() < big_int::get_thresholds().to_string)
+        return small_to_string(a, buffer, digits, radix);
 
-    // Compute n, such as 10^(2^(n + 1)) is approximately a
-    const int n = static_cast<int>(std::round(
-        std::log2(static_cast<double>(big_int_impl::count_bits(a)) / std::log2(10)) - 1
-    ));
-    const int expected_digits = 1 << n;
-    const bint_t& big10 = compute_power10_with_cache(n);
+    const int n = radix_power_split_index(a, radix);
+    const int low_digits = 1 << n;
+    const auto big_power = big_int_impl::radix_power(radix, n);
 
     bint_t high = a;
     bint_t low;
     big_int_impl::normalize(high);
-    big_int::divide_abs(high, big10, low);
-    to_string(high, buffer, digits - expected_digits);
-    to_string(low, buffer, expected_digits);
+    big_power->divide_abs(high, low);
+
+    // Both halves have known places in the buffer, so they are independent
+    const int high_digits = digits - low_digits;
+    if (big_int_impl::thread_pool* pool = big_int_impl::parallel_pool(a.data.size())) {
+        big_int_impl::parallel_invoke(*pool,
+            [&] { to_string(high, buffer, high_digits, radix); },
+            [&] { to_string(low, buffer + high_digits, low_digits, radix); });
+    } else {
+        to_string(high, buffer, high_digits, radix);
+        to_string(low, buffer + high_digits, low_digits, radix);
+    }
+}
+
+/**
+ * Value of `count` digits starting from `digits`
+ */
+inline uint64_t read_group_digits(const char* digits, const int count, const int radix) {
+    uint64_t value = 0;
+    for (int i = 0; i < count; i++) {
+        value = value * radix + radix_digit_value(digits[i]);
+    }
+    return value;
+}
+
+bint_t small_from_digits(const char* digits, const int length, const int radix) {
+    const digit_group& group = get_digit_group(radix);
+
+    bint_t result(0);
+    result.data.reserve(length / group.digits + 1);
+    // The first group is shorter, so that the rest of the groups have exactly `group.digits` digits
+    int group_length = length % group.digits == 0 ? group.digits : length % group.digits;
+    for (int position = 0; position < length; position += group_length, group_length = group.digits) {
+        // The constant radix turns the decimal multiplications into shifts and additions
+        uint64_t value = radix == 10
+            ? read_group_digits(digits + position, group_length, 10)
+            : read_group_digits(digits + position, group_length, radix);
+        uint64_t power = group.divisor.divisor;
+        if (group_length < group.digits) {
+            power = 1;
+            for (int i = 0; i < group_length; i++) power *= radix;
+        }
+
+        // result = result * radix^group_length + value, the sum fits into one more limb
+        uint64_t* limbs = result.data.data();
+        const int size = result.data.size();
+        const uint64_t high = big_int_impl::limbs_mul_1(limbs, limbs, size, power);
+        const uint64_t carry = big_int_impl::limbs_add_inplace(limbs, size, &value, 1);
+        if (high + carry != 0) result.data.push_back(high + carry);
+    }
+    big_int_impl::normalize(result);
+    return result;
+}
+
+/**
+ * `n`, such as `2^n` is the number of the low digits in the split of `length` digits: `length / 2 <= 2^n < length`
+ */
+int radix_digits_split_index(const int length) {
+    return std::bit_width(static_cast<unsigned>(length - 1)) - 1;
+}
+
+bint_t bint_t::from_digits(const char* digits, const int length, const int radix) { // NOLINT(*-no-recursion)
+    if (length < big_int::get_thresholds().from_string * digits_per_limb(radix))
+        return small_from_digits(digits, length, radix);
+
+    // `high * radix^low_digits + low`, the halves are independent
+    const int n = radix_digits_split_index(length);
+    const int low_digits = 1 << n;
+    const int high_digits = length - low_digits;
+    const auto big_power = big_int_impl::radix_power(radix, n);
+
+    bint_t high, low;
+    if (big_int_impl::thread_pool* pool = big_int_impl::parallel_pool(static_cast<int>(length / digits_per_limb(radix)))) {
+        big_int_impl::parallel_invoke(*pool,
+            [&] { high = from_digits(digits, high_digits, radix); },
+            [&] { low = from_digits(digits + high_digits, low_digits, radix); });
+    } else {
+        high = from_digits(digits, high_digits, radix);
+        low = from_digits(digits + high_digits, low_digits, radix);
+    }
+    big_int::muladd(high, big_power->value(), low);
+    return high;
+}
+
+void check_radix(const int radix, const char* function) {
+    if (radix < 2 || radix > 36) {
+        throw std::invalid_argument(std::string(function) + ": radix[" + std::to_string(radix) + "] is not in [2, 36]");
+    }
+}
+
+std::from_chars_result bint_t::from_chars(const char* first, const char* last, bint_t& value, const int radix) {
+    check_radix(radix, "bint_t::from_chars");
+    const char* begin = first;
+    const bool negative = begin != last && *begin == '-';
+    if (negative) begin++;
+
+    // Blocks of digits are checked with a single branch, the last block is checked digit by digit
+    const char* end = begin;
+    constexpr int block = 8;
+    while (last - end >= block) {
+        int max_value = 0;
+        for (int i = 0; i < block; i++) max_value = std::max(max_value, radix_digit_value(end[i]));
+        if (max_value >= radix) break;
+        end += block;
+    }
+    while (end != last && radix_digit_value(*end) < radix) end++;
+    if (end == begin)
+        return {first, std::errc::invalid_argument};
+
+    // Leading zeroes don't change the value, but make the halves of the split unbalanced
+    while (begin + 1 < end && *begin == '0') begin++;
+    const int length = static_cast<int>(end - begin);
+
+    if (std::has_single_bit(static_cast<unsigned>(radix))) {
+        value = power2_radix_from_digits(begin, length, std::countr_zero(static_cast<unsigned>(radix)));
+    } else {
+        value = from_digits(begin, length, radix);
+    }
+    value.sign = negative;
+    big_int_impl::normalize(value);
+    return {end, std::errc()};
 }
 
-std::string bint_t::to_string() const {
-    std::string result;
-    const int expected_length = this->data.size() * 64 / std::log2(10.0) + 1;
-    result.reserve(expected_length + (this->sign ? 1 : 0));
+bint_t bint_t::from_string(const std::string_view str, const int radix) {
+    check_radix(radix, "bint_t::from_string");
+    bint_t result;
+    const auto [end, error] = from_chars(str.data(), str.data() + str.size(), result, radix);
+    if (error != std::errc() || end != str.data() + str.size()) {
+        throw std::invalid_argument("bint_t::from_string: not a number in radix " + std::to_string(radix) +
+            " at position " + std::to_string(error != std::errc() ? 0 : end - str.data()));
+    }
+    return result;
+}
+
+std::string bint_t::to_string(const int radix) const {
+    check_radix(radix, "bint_t::to_string");
+    const int sign_length = this->sign ? 1 : 0;
+    const uint64_t bits = big_int_impl::count_bits(*this);
+    if (std::has_single_bit(static_cast<unsigned>(radix))) {
+        // The number of digits is exact, there are no leading zeroes
+        const int bits_per_digit = std::countr_zero(static_cast<unsigned>(radix));
+        const int digits = std::max<int>(1, (bits + bits_per_digit - 1) / bits_per_digit);
+        std::string result(sign_length + digits, '0');
+        if (this->sign) result[0] = '-';
+        power2_radix_to_string(*this, result.data() + sign_length, digits, bits_per_digit);
+        return result;
+    }
+
+    // Upper bound of the number of digits, the leading zeroes are removed in the end
+    const int digits = static_cast<int>(static_cast<double>(bits) / std::log2(radix)) + 2;
+    std::string result(sign_length + digits, '0');
+    if (this->sign) result[0] = '-';
+
+    to_string(*this, result.data() + sign_length, digits, radix);
 
-    if (this->sign) result.push_back('-');
-    to_string(*this, result, 0);
+    const auto first_digit = result.find_first_not_of('0', sign_length);
+    const auto leading_zeroes = (first_digit == std::string::npos ? result.size() - 1 : first_digit) - sign_length;
+    result.erase(sign_length, leading_zeroes);
     return result;
 }
 
+/**
+ * Collects digits into chunks of a fixed size for a sink
+ */
+class chunked_digit_writer {
+public:
+    chunked_digit_writer(const bint_t::digit_sink& sink, const size_t chunk_size) : chunk_size(chunk_size), sink(sink) {
+        if (chunk_size == 0) throw std::invalid_argument("bint_t::write_digits: chunk_size is zero");
+        buffer.reserve(chunk_size);
+    }
+
+    void write(std::string_view digits) {
+        while (!digits.empty()) {
+            const size_t count = std::min(digits.size(), chunk_size - buffer.size());
+            buffer.append(digits.substr(0, count));
+            digits.remove_prefix(count);
+            if (buffer.size() == chunk_size) flush();
+        }
+    }
+
+    void flush() {
+        if (buffer.empty()) return;
+        sink(buffer);
+        buffer.clear();
+    }
+
+    const size_t chunk_size;
+
+private:
+    const bint_t::digit_sink& sink;
+    std::string buffer;
+};
+
+void bint_t::write_digits(bint_t&& a, const int64_t digits, const int radix, chunked_digit_writer& writer) { // NOLINT(*-no-recursion)
+    const int64_t max_digits = digits >= 0
+        ? digits
+        : static_cast<int64_t>(static_cast<double>(big_int_impl::count_bits(a)) / std::log2(radix)) + 2;
+    if (max_digits <= static_cast<int64_t>(writer.chunk_size) || a.data.size() < big_int::get_thresholds().to_string) {
+        std::string part(max_digits, '0');
+        to_string(a, part.data(), static_cast<int>(max_digits), radix);
+        const size_t leading_zeroes = digits >= 0 ? 0 : std::min(part.find_first_not_of('0'), part.size() - 1);
+        writer.write(std::string_view(part).substr(leading_zeroes));
+        return;
+    }
+
+    // `a` becomes the high half, storage of every level is released as soon as it is split
+    const int n = radix_power_split_index(a, radix);
+    const int64_t low_digits = int64_t(1) << n;
+    bint_t low;
+    big_int_impl::radix_power(radix, n)->divide_abs(a, low);
+    if (digits < 0 && big_int_impl::is_zero(a)) {
+        write_digits(std::move(low), -1, radix, writer);
+        return;
+    }
+    write_digits(std::move(a), digits >= 0 ? digits - low_digits : -1, radix, writer);
+    write_digits(std::move(low), low_digits, radix, writer);
+}
+
+void bint_t::write_digits(const digit_sink& sink, const int radix, const size_t chunk_size) const {
+    check_radix(radix, "bint_t::write_digits");
+    chunked_digit_writer writer(sink, chunk_size);
+    if (this->sign) writer.write("-");
+
+    if (std::has_single_bit(static_cast<unsigned>(radix))) {
+        // Slices of a multiple of `bits_per_digit` limbs hold whole digits, they are written from the highest one
+        const int bits_per_digit = std::countr_zero(static_cast<unsigned>(radix));
+        const int slice_limbs = std::max<int>(1, chunk_size * bits_per_digit / 64 / bits_per_digit) * bits_per_digit;
+        const int size = this->data.size();
+        std::string part;
+        for (int end = size, begin = (size - 1) / slice_limbs * slice_limbs; end > 0; end = begin, begin -= slice_limbs) {
+            bint_t slice;
+            slice.data.assign(this->data.begin() + begin, this->data.begin() + end);
+            big_int_impl::normalize(slice);
+            const int digits = end == size
+                ? std::max<int>(1, (big_int_impl::count_bits(slice) + bits_per_digit - 1) / bits_per_digit)
+                : (end - begin) * 64 / bits_per_digit;
+            part.assign(digits, '0');
+            power2_radix_to_string(slice, part.data(), digits, bits_per_digit);
+            writer.write(part);
+        }
+    } else {
+        bint_t a = *this;
+        a.sign = false;
+        write_digits(std::move(a), -1, radix, writer);
+    }
+    writer.flush();
+}
+
+void bint_t::write_digits(std::ostream& stream, const int radix) const {
+    write_digits([&](const std::string_view chunk) {
+        stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    }, radix);
+}
 
+void bint_t::write_digits_to_fd(const int fd, const int radix) const {
+    write_digits([&](std::string_view chunk) {
+        while (!chunk.empty()) {
+            const ssize_t written = ::write(fd, chunk.data(), chunk.size());
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::system_error(errno, std::generic_category(), "bint_t::write_digits_to_fd");
+            }
+            chunk.remove_prefix(written);
+        }
+    }, radix);
+}
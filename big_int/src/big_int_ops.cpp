@@ -5,25 +5,28 @@
 #include "big_int/big_int_ops.h"
 
 #include "big_int/burnikel_ziegler.h"
+#include "big_int/exact_division.h"
 #include "big_int/karatsuba.h"
+#include "big_int/limbs.h"
+#include "big_int/newton_division.h"
+#include "big_int/ntt.h"
 #include "big_int/toom_cook.h"
 
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
 /**
  * Fast implementation for `a = a - (b * c << offset * 64)`, optimized for Knuth's division.
  * Does not normalize output intentionally.
  */
 uint64_t sub_mul_abs_uint64(bint_t& a, const bint_t& b, const uint64_t c, const int offset) {
-    if (offset > a.data.size()) throw std::runtime_error("sub_mul_abs_uint64_special: offset > a.data.size()");
+    if (offset + b.data.size() > a.data.size()) throw std::runtime_error("sub_mul_abs_uint64: offset + b.data.size() > a.data.size()");
     if (c == 0) return 0; // a - 0 == a
 
-    const __uint128_t factor = c;
-    uint64_t carry = 0;
-    for (int i = offset; i < a.data.size() || i - offset < b.data.size(); i++) {
-        __uint128_t _mc = a.data[i];
-        _mc -= carry;
-        if (i - offset < b.data.size()) _mc -= factor * b.data[i - offset];
-        carry = -static_cast<uint64_t>(_mc >> 64);
-        a.data[i] = static_cast<uint64_t>(_mc);
+    uint64_t carry = big_int_impl::limbs_submul_1(a.data.data() + offset, b.data.data(), b.data.size(), c);
+    for (int i = offset + b.data.size(); i < a.data.size() && carry > 0; i++) {
+        carry = __builtin_sub_overflow(a.data[i], carry, &a.data[i]);
     }
 
     // Don't normalize `a` -- this is intentional
@@ -37,20 +40,13 @@ void add_mul_abs_uint64(bint_t& a, const bint_t& b, const uint64_t c, const int
     if (c == 0) return; // a + 0 == a
     if (left_shift > a.data.size()) throw std::runtime_error("add_mul_abs_uint64: left_shift > a.data.size()");
 
-    const __uint128_t factor = c;
-    uint64_t carry = 0;
-    for (int i = left_shift; i < a.data.size() || i < b.data.size() + left_shift - b_start; i++) {
-        __uint128_t _mc = a.data[i];
-        _mc += carry;
-        if (i - left_shift + b_start < b.data.size()) {
-            _mc += factor * b.data[i - left_shift + b_start];
-        }
-        carry = static_cast<uint64_t>(_mc >> 64);
-        if (i < a.data.size()) {
-            a.data[i] = static_cast<uint64_t>(_mc);
-        } else {
-            a.data.push_back(static_cast<uint64_t>(_mc));
-        }
+    const int size = static_cast<int>(b.data.size()) - b_start;
+    if (size <= 0) return;
+    if (a.data.size() < left_shift + size) a.data.resize(left_shift + size);
+
+    uint64_t carry = big_int_impl::limbs_addmul_1(a.data.data() + left_shift, b.data.data() + b_start, size, c);
+    for (int i = left_shift + size; i < a.data.size() && carry > 0; i++) {
+        carry = __builtin_add_overflow(a.data[i], carry, &a.data[i]);
     }
 
     if (carry > 0) {
@@ -61,21 +57,7 @@ void add_mul_abs_uint64(bint_t& a, const bint_t& b, const uint64_t c, const int
 bint_t schoolbook_mul_abs(const bint_t& a, const bint_t& b, const int a_limit, const int b_limit) {
     bint_t result;
     result.data.resize(a_limit + b_limit);
-    for (int i = 0; i < b_limit; i++) {
-        const __uint128_t factor = b.data[i];
-        if (factor == 0)
-            continue;
-
-        uint64_t carry = 0;
-        for (int j = i; j < a_limit + i; j++) {
-            __uint128_t c = carry;
-            c += factor * a.data[j - i];
-            c += result.data[j];
-            carry = c >> 64;
-            result.data[j] = static_cast<uint64_t>(c);
-        }
-        result.data[a_limit + i] = carry;
-    }
+    big_int_impl::limbs_mul_basecase(result.data.data(), a.data.data(), a_limit, b.data.data(), b_limit);
     return result;
 }
 
@@ -84,17 +66,11 @@ bint_t mul_uint64(const bint_t& a, const uint64_t b, int a_limit, const bool new
     if (a_limit < 0) a_limit = a.data.size();
 
     bint_t result;
-    result.data.reserve(a_limit + 1);
-    const __uint128_t factor = b;
-    uint64_t carry = 0;
-    for (int i = 0; i < a_limit; i++) {
-        const auto& element = a.data[i];
-        const __uint128_t c = factor * element + carry;
-        carry = c >> 64;
-        result.data.push_back(static_cast<uint64_t>(c));
-    }
-    if (carry > 0) result.data.push_back(carry);
+    result.data.resize(a_limit + 1);
+    result.data[a_limit] = big_int_impl::limbs_mul_1(result.data.data(), a.data.data(), a_limit, b);
     result.sign = new_sign;
+    // Limited operands can have zero high limbs
+    big_int_impl::normalize(result);
     return result;
 }
 
@@ -102,7 +78,7 @@ bint_t mul_uint64(const bint_t& a, const uint64_t b, int a_limit, const bool new
  * Knuth's algorithm D for the long division.
  * Implementation is inspired by https://skanthak.hier-im-netz.de/division.html
  */
-void divide_knuth_abs_inner(bint_t& a, const bint_t& b, bint_t& rem) {
+void divide_knuth_abs_inner(bint_t& a, const bint_t& b, bint_t& rem, const big_int::division_output output) {
     if (a.data.back() == 0) throw std::runtime_error("divide_knuth_abs_inner: leading zeroes in divident");
     if (b.data.back() == 0) throw std::runtime_error("divide_knuth_abs_inner: leading zeroes in divisor");
 
@@ -118,7 +94,7 @@ void divide_knuth_abs_inner(bint_t& a, const bint_t& b, bint_t& rem) {
         __uint128_t qhat = a_part / b.data[n - 1];
         __uint128_t rhat = a_part % b.data[n - 1];
 
-        while (qhat >> 64 != 0 || static_cast<uint64_t>(qhat) * static_cast<__uint128_t>(b.data[n - 2]) > (rhat << 64) + a.data[i + n - 2]) {
+        while (qhat >> 64 != 0 || (n > 1 && static_cast<uint64_t>(qhat) * static_cast<__uint128_t>(b.data[n - 2]) > (rhat << 64) + a.data[i + n - 2])) {
             qhat--;
             rhat += b.data[n - 1];
             if (rhat >> 64 != 0) break;
@@ -129,40 +105,28 @@ void divide_knuth_abs_inner(bint_t& a, const bint_t& b, bint_t& rem) {
             qhat--;
             big_int_impl::add_abs_inplace(a, b, 0, -1, i, true);
         }
-        result.data.push_back(qhat);
+        if (output != big_int::division_output::remainder) result.data.push_back(qhat);
 
         // Remove last digit of `a`: it is always 0
         if (a.data.back() != 0) throw std::runtime_error("divide_knuth_abs_inner: a.data.back() != 0 after division step");
         a.data.pop_back();
     }
 
-    rem = a;
-    big_int_impl::normalize(rem);
+    // `a` holds the remainder now, it is moved out before the quotient is written over it
+    if (output != big_int::division_output::quotient) {
+        rem = std::move(a);
+        big_int_impl::normalize(rem);
+    }
+    if (output == big_int::division_output::remainder) {
+        a = bint_t(0);
+        return;
+    }
 
     a.data.resize(result.data.size());
     std::copy(result.data.rbegin(), result.data.rend(), a.data.begin());
     big_int_impl::normalize(a);
 }
 
-bint_t add_abs(const bint_t& a, const bint_t& b) {
-    bint_t copy = a;
-    big_int_impl::add_abs_inplace(copy, b);
-    return copy;
-}
-
-bint_t sub_abs(const bint_t& a, const bint_t& b) { // NOLINT(*-no-recursion)
-    if (big_int_impl::compare_abs(a, b) < 0) {
-        auto result = sub_abs(b, a);
-        result.sign = true;
-        return result;
-    }
-
-    bint_t copy = a;
-    copy.sign = false;
-    big_int_impl::sub_abs_inplace(copy, b);
-    return copy;
-}
-
 void shift_left_inplace_blocks(bint_t& a, const int shift_blocks) {
     if (shift_blocks == 0) return;
     a.data.resize(a.data.size() + shift_blocks);
@@ -215,24 +179,9 @@ void shift_right_inplace_in_block(bint_t& a, const int shift) {
 bint_t big_int_impl::schoolbook_square(const bint_t& a, int a_limit) {
     if (a_limit < 0) a_limit = a.data.size();
 
-    bint_t result(0);
+    bint_t result;
     result.data.resize(2 * a_limit);
-
-    uint64_t last_low_word = 0;
-    for (int i = a_limit - 1; i >= 0; i--) {
-        __uint128_t c = a.data[i];
-        c *= c;
-        result.data[2 * i] = static_cast<uint64_t>(c >> 1);
-        result.data[2 * i + 1] = last_low_word << 63 | static_cast<uint64_t>(c >> 65);
-        last_low_word = static_cast<uint64_t>(c);
-    }
-
-    for (int i = 1; i < a_limit; i++) {
-        add_mul_abs_uint64(result, a, a.data[a_limit - i - 1], a_limit - i, (a_limit - i) * 2 - 1);
-    }
-
-    result <<= 1;
-    result.data[0] |= a.data[0] & 1;
+    limbs_square_basecase(result.data.data(), a.data.data(), a_limit);
     normalize(result);
     return result;
 }
@@ -257,10 +206,12 @@ void big_int_impl::add_abs_inplace(bint_t& a, const bint_t& b, const int b_start
     if (b_limit < 0) b_limit = b.data.size();
     uint64_t carry = 0;
     for (int i = std::min<int>(b_shift, a.data.size()); i < a.data.size() || i - b_shift < b_limit - b_start; i++) {
+        // The rest of `a` is unchanged when `b` is over and there is no carry
+        if (i - b_shift >= b_limit - b_start && carry == 0) break;
         uint64_t c = carry;
         carry = 0;
-        if (i < a.data.size()) carry |= __builtin_uaddll_overflow(a.data[i], c, &c);
-        if (i >= b_shift && i - b_shift < b_limit - b_start) carry |= __builtin_uaddll_overflow(b.data[i - b_shift + b_start], c, &c);
+        if (i < a.data.size()) carry |= __builtin_add_overflow(a.data[i], c, &c);
+        if (i >= b_shift && i - b_shift < b_limit - b_start) carry |= __builtin_add_overflow(b.data[i - b_shift + b_start], c, &c);
         if (i < a.data.size()) {
             a.data[i] = c;
         } else {
@@ -291,16 +242,46 @@ void big_int_impl::sub_abs_inplace(bint_t& a, const bint_t& b, int b_limit) {
  * Optimized version for division by uint64_t
  */
 void big_int_impl::div_abs_inplace(bint_t& a, const uint64_t b, uint64_t& rem) {
-    __uint128_t current = 0;
-    for (int i = a.data.size() - 1; i >= 0; i--) {
-        current = (current << 64) + a.data[i];
-        a.data[i] = current / b;
-        current %= b;
-    }
+    rem = limbs_div_1(a.data.data(), a.data.data(), a.data.size(), b);
     while (a.data.size() > 1 && a.data.back() == 0) {
         a.data.pop_back();
     }
-    rem = current;
+}
+
+/**
+ * Exact division by uint64_t: multiplication by the inverse of `b` modulo 2^64, no remainders are computed
+ */
+bool big_int_impl::divexact_abs_inplace(bint_t& a, const uint64_t b) {
+    const bool divisible = limbs_divexact_1(a.data.data(), a.data.data(), a.data.size(), b) == 0;
+    normalize(a);
+    return divisible;
+}
+
+/**
+ * Multiplication of operands with very different sizes: the larger operand is sliced into pieces
+ * of the size of the smaller one, products of the pieces are accumulated into the result
+ */
+bint_t big_int_impl::multiply_unbalanced(const bint_t& a, const bint_t& b, int a_limit, int b_limit) { // NOLINT(*-no-recursion)
+    if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
+    if (a_limit < b_limit) return multiply_unbalanced(b, a, b_limit, a_limit);
+    // A single slice is the whole operand, its product would be dispatched here again
+    if (a_limit < 2 * b_limit) return toom42(a, b, a_limit, b_limit);
+
+    bint_t result;
+    result.data.resize(a_limit + b_limit);
+    bint_t slice;
+    for (int start = 0; start < a_limit; start += b_limit) {
+        const int slice_size = std::min(b_limit, a_limit - start);
+        slice.data.assign(a.data.begin() + start, a.data.begin() + start + slice_size);
+        normalize(slice);
+        const auto product = big_int::multiply(slice, b, -1, b_limit);
+        add_abs_inplace(result, product, 0, -1, start, true);
+    }
+
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
 }
 
 bint_t big_int_impl::schoolbook_multiply(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
@@ -312,6 +293,83 @@ bint_t big_int_impl::schoolbook_multiply(const bint_t& a, const bint_t& b, int a
     return result;
 }
 
+void big_int_impl::add_signed_inplace(bint_t& a, const bint_t& b, const bool negate_b) {
+    const bool b_sign = b.sign ^ negate_b;
+    if (&a == &b) {
+        if (a.sign == b_sign) {
+            big_int::shift_left_inplace(a, 1);
+        } else {
+            a.data.assign(1, 0);
+            a.sign = false;
+        }
+        return;
+    }
+
+    const int a_size = a.data.size();
+    const int b_size = b.data.size();
+    const int size = std::max(a_size, b_size);
+    if (a.sign == b_sign) {
+        a.data.resize(size + 1);
+        a.data[size] = limbs_add_inplace(a.data.data(), size, b.data.data(), b_size);
+    } else {
+        a.data.resize(size);
+        if (limbs_abs_diff(a.data.data(), a.data.data(), size, b.data.data(), b_size)) a.sign = b_sign;
+    }
+    normalize(a);
+}
+
+void big_int_impl::sub_abs_reversed_inplace(bint_t& a, const bint_t& b) {
+    const int a_size = a.data.size();
+    const int b_size = b.data.size();
+    if (a_size > b_size) throw std::runtime_error("sub_abs_reversed_inplace: a.data.size() > b.data.size()");
+    a.data.resize(b_size);
+    if (limbs_sub(a.data.data(), b.data.data(), b_size, a.data.data(), a_size) != 0)
+        throw std::runtime_error("sub_abs_reversed_inplace: |a| > |b|");
+    normalize(a);
+}
+
+void big_int_impl::mul_abs_inplace(bint_t& a, const uint64_t b) {
+    const uint64_t carry = limbs_mul_1(a.data.data(), a.data.data(), a.data.size(), b);
+    if (carry > 0) a.data.push_back(carry);
+    normalize(a);
+}
+
+void big_int_impl::accumulate_product_abs(bint_t& a, const uint64_t* x, const int x_size,
+                                          const uint64_t* y, const int y_size, const bool negative) {
+    if (x_size == 0 || y_size == 0)
+        return;
+    if (a.data.empty() || (a.data.size() == 1 && a.data[0] == 0))
+        a.sign = negative;
+
+    // `a` and `x * y` both fit in `size - 1` limbs, so the sum doesn't overflow and the difference wraps at most once
+    const int size = std::max<int>(a.data.size(), x_size + y_size) + 1;
+    a.data.resize(size);
+    uint64_t* r = a.data.data();
+    if (a.sign == negative) {
+        for (int j = 0; j < y_size; j++) {
+            const uint64_t carry = limbs_addmul_1(r + j, x, x_size, y[j]);
+            limbs_add_inplace(r + j + x_size, size - j - x_size, &carry, 1);
+        }
+    } else {
+        bool wrapped = false;
+        for (int j = 0; j < y_size; j++) {
+            uint64_t borrow = limbs_submul_1(r + j, x, x_size, y[j]);
+            for (int i = j + x_size; i < size && borrow > 0; i++) {
+                borrow = __builtin_sub_overflow(r[i], borrow, &r[i]);
+            }
+            wrapped |= borrow > 0;
+        }
+        if (wrapped) {
+            // `|a| < x * y`: negate the two's complement result and the sign
+            for (int i = 0; i < size; i++) r[i] = ~r[i];
+            const uint64_t one = 1;
+            limbs_add_inplace(r, size, &one, 1);
+            a.sign = !a.sign;
+        }
+    }
+    normalize(a);
+}
+
 uint64_t big_int_impl::count_bits(const bint_t& a) {
     if (a.data.size() > 1 && a.data.back() == 0) {
         throw std::runtime_error("count_bits: value is not normalized");
@@ -329,55 +387,68 @@ void big_int_impl::normalize(bint_t& a) {
     }
 }
 
+bool big_int_impl::is_zero(const bint_t& a) {
+    return a.data.size() == 1 && a.data[0] == 0;
+}
+
 bool big_int_impl::is_normalized(const bint_t& a) {
     return a.data.size() == 1 || !a.data.empty() && a.data.back() > 0;
 }
 
 void big_int_impl::square(bint_t& a, int a_limit) {
     if (a_limit < 0) a_limit = a.data.size();
+    const auto& thresholds = big_int::get_thresholds();
+
+    if (a_limit >= thresholds.ntt_square) {
+        ntt_square(a, a_limit);
+        return;
+    }
 
-    if (a_limit < big_int::KARATSUBA_SQUARE_THRESHOLD) {
+    if (a_limit < thresholds.karatsuba_square) {
         a = schoolbook_square(a, a_limit);
         return;
     }
 
-    if (a_limit < big_int::TOOM_COOK_SQUARE_THRESHOLD) {
+    if (a_limit < thresholds.toom_cook_square) {
         karatsuba_square(a, a_limit);
         return;
     }
 
-    toom3_square(a, a_limit);
+    if (a_limit < thresholds.toom_4_square) {
+        toom3_square(a, a_limit);
+        return;
+    }
+
+    if (a_limit < thresholds.toom_6h_square) {
+        toom4_square(a, a_limit);
+        return;
+    }
+
+    toom6h_square(a, a_limit);
 }
 
 // ================ namespace big_int ================
 
 bint_t big_int::add(const bint_t& a, const bint_t& b) {
-    if (!a.sign && b.sign) return sub_abs(a, b);
-    if (a.sign && !b.sign) return sub_abs(b, a);
-    if (a.sign) { // => b.sign
-        auto result = add_abs(a, b);
-        result.sign = true;
-        big_int_impl::normalize(result);
-        return result;
-    }
-    return add_abs(a, b);
+    bint_t result;
+    result.data.reserve(std::max(a.data.size(), b.data.size()) + 1);
+    result = a;
+    big_int_impl::add_signed_inplace(result, b);
+    return result;
 }
 
 bint_t big_int::sub(const bint_t& a, const bint_t& b) {
-    if (!a.sign && b.sign) return add_abs(a, b);
-    if (a.sign && !b.sign) {
-        auto result = add_abs(a, b);
-        result.sign = true;
-        big_int_impl::normalize(result);
-        return result;
-    }
-    if (a.sign) return sub_abs(b, a);
-    return sub_abs(a, b);
+    bint_t result;
+    result.data.reserve(std::max(a.data.size(), b.data.size()) + 1);
+    result = a;
+    big_int_impl::add_signed_inplace(result, b, true);
+    return result;
 }
 
 bint_t big_int::multiply(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
     if (a_limit < 0) a_limit = a.data.size();
     if (b_limit < 0) b_limit = b.data.size();
+    const auto& thresholds = get_thresholds();
 
     // Check if possible to calculate a square instead
     if (&a == &b && a_limit == b_limit) {
@@ -386,7 +457,7 @@ bint_t big_int::multiply(const bint_t& a, const bint_t& b, int a_limit, int b_li
         return result;
     }
 
-    if (a_limit < KARATSUBA_THRESHOLD || b_limit < KARATSUBA_THRESHOLD) {
+    if (a_limit < thresholds.karatsuba || b_limit < thresholds.karatsuba) {
         if (a_limit == 1)
             return mul_uint64(b, a.data[0], b_limit, a.sign ^ b.sign);
         if (b_limit == 1)
@@ -395,40 +466,150 @@ bint_t big_int::multiply(const bint_t& a, const bint_t& b, int a_limit, int b_li
         return big_int_impl::schoolbook_multiply(a, b, a_limit, b_limit);
     }
 
-    if (a_limit < TOOM_COOK_THRESHOLD && b_limit < TOOM_COOK_THRESHOLD)
+    if (a_limit >= thresholds.ntt && b_limit >= thresholds.ntt)
+        return ntt_multiply(a, b, a_limit, b_limit);
+
+    // Unbalanced operands: splitting both into pieces of the same size produces a lot of zero pieces
+    const int max_limit = std::max(a_limit, b_limit);
+    const int min_limit = std::min(a_limit, b_limit);
+    if (max_limit >= thresholds.unbalanced_slice_ratio * min_limit)
+        return big_int_impl::multiply_unbalanced(a, b, a_limit, b_limit);
+    if (max_limit >= thresholds.toom_42_ratio * min_limit)
+        return toom42(a, b, a_limit, b_limit);
+    if (max_limit >= thresholds.toom_32_ratio * min_limit)
+        return toom32(a, b, a_limit, b_limit);
+
+    if (a_limit < thresholds.toom_cook && b_limit < thresholds.toom_cook)
         return karatsuba(a, b, a_limit, b_limit);
 
-    return toom3(a, b, a_limit, b_limit);
+    if (a_limit < thresholds.toom_4 && b_limit < thresholds.toom_4)
+        return toom3(a, b, a_limit, b_limit);
+
+    if (a_limit < thresholds.toom_6h && b_limit < thresholds.toom_6h)
+        return toom4(a, b, a_limit, b_limit);
+
+    return toom6h(a, b, a_limit, b_limit);
 }
 
-void big_int::divide_abs(bint_t& a, const bint_t& b, bint_t& rem) {
-    if (a.data.size() < BURNIKEL_ZIEGLER_THRESHOLD && b.data.size() < BURNIKEL_ZIEGLER_THRESHOLD) {
-        return divide_knuth_abs(a, b, rem);
+namespace {
+    /**
+     * `a += (-1)^negative * b * c`
+     */
+    void accumulate_product(bint_t& a, const bint_t& b, const bint_t& c, const bool negative) {
+        const bool product_negative = negative ^ b.sign ^ c.sign;
+        const int min_size = std::min(b.data.size(), c.data.size());
+        if (&a == &b || &a == &c || min_size >= big_int::get_thresholds().karatsuba) {
+            // The product of big operands is computed by a subquadratic algorithm anyway
+            const bint_t product = big_int::multiply(b, c);
+            const uint64_t one = 1;
+            big_int_impl::accumulate_product_abs(a, product.data.data(), product.data.size(), &one, 1, product_negative);
+            return;
+        }
+
+        const bool b_longer = b.data.size() >= c.data.size();
+        const bint_t& x = b_longer ? b : c;
+        const bint_t& y = b_longer ? c : b;
+        big_int_impl::accumulate_product_abs(a, x.data.data(), x.data.size(), y.data.data(), y.data.size(), product_negative);
+    }
+
+    void accumulate_product(bint_t& a, const bint_t& b, const uint64_t c, const bool negative) {
+        if (&a == &b) {
+            const bint_t copy = b;
+            return accumulate_product(a, copy, c, negative);
+        }
+        big_int_impl::accumulate_product_abs(a, b.data.data(), b.data.size(), &c, 1, negative ^ b.sign);
     }
+}
+
+void big_int::addmul(bint_t& a, const bint_t& b, const bint_t& c) {
+    accumulate_product(a, b, c, false);
+}
+
+void big_int::addmul(bint_t& a, const bint_t& b, const uint64_t c) {
+    accumulate_product(a, b, c, false);
+}
+
+void big_int::submul(bint_t& a, const bint_t& b, const bint_t& c) {
+    accumulate_product(a, b, c, true);
+}
 
-    return divide_burnikel_ziegler(a, b, rem);
+void big_int::submul(bint_t& a, const bint_t& b, const uint64_t c) {
+    accumulate_product(a, b, c, true);
+}
+
+void big_int::muladd(bint_t& a, const bint_t& b, const bint_t& c) {
+    if (&a == &c) {
+        const bint_t copy = c;
+        return muladd(a, b, copy);
+    }
+    a *= b;
+    const uint64_t one = 1;
+    big_int_impl::accumulate_product_abs(a, c.data.data(), c.data.size(), &one, 1, c.sign);
+}
+
+void big_int::divide_abs(bint_t& a, const bint_t& b, bint_t& rem, const division_output output) {
+    const auto& thresholds = get_thresholds();
+    const int threshold = thresholds.burnikel_ziegler;
+    if (a.data.size() < threshold && b.data.size() < threshold) {
+        divide_knuth_abs(a, b, rem, output);
+    } else if (b.data.size() >= thresholds.newton_division) {
+        divide_newton(a, b, rem, output);
+    } else {
+        divide_burnikel_ziegler(a, b, rem, output);
+    }
+
+    // Both results are absolute values, the callers apply signs
+    a.sign = false;
+    rem.sign = false;
+    big_int_impl::normalize(a);
+}
+
+std::pair<bint_t, bint_t> big_int::divmod(const bint_t& a, const bint_t& b) {
+    const bool negative = a.sign ^ b.sign;
+    bint_t quotient = a;
+    bint_t rem;
+    divide_abs(quotient, b, rem);
+    if (!big_int_impl::is_zero(rem)) {
+        // Floor division: the quotient is rounded down, the remainder has the sign of the divisor
+        if (negative) {
+            big_int_impl::add_abs_inplace(quotient, bint_t(1));
+            big_int_impl::sub_abs_reversed_inplace(rem, b);
+        }
+        rem.sign = b.sign;
+    }
+    quotient.sign = negative;
+    big_int_impl::normalize(quotient);
+    return {std::move(quotient), std::move(rem)};
+}
+
+bint_t big_int::divexact(const bint_t& a, const bint_t& b) {
+    bint_t result = a;
+    divide_exact(result, b);
+    result.sign = a.sign ^ b.sign;
+    big_int_impl::normalize(result);
+    return result;
 }
 
 /**
  * Preparation for the Knuth's algorithm D: shift left until the highest digit of the divisor is at least 2^63
  */
-void big_int::divide_knuth_abs(bint_t& a, const bint_t& b, bint_t& rem) {
+void big_int::divide_knuth_abs(bint_t& a, const bint_t& b, bint_t& rem, const division_output output) {
     if (big_int_impl::compare_abs(a, b) < 0) {
-        rem = a;
+        rem = std::move(a);
         a = bint_t(0ll);
         return;
     }
 
     if (b.data.back() >= 1ull << 63) {
-        return divide_knuth_abs_inner(a, b, rem);
+        return divide_knuth_abs_inner(a, b, rem, output);
     }
 
     bint_t new_b = b;
     const int shift = std::countl_zero(new_b.data.back());
     new_b <<= shift;
     a <<= shift;
-    divide_knuth_abs_inner(a, new_b, rem);
-    rem >>= shift;
+    divide_knuth_abs_inner(a, new_b, rem, output);
+    if (output != division_output::quotient) rem >>= shift;
 }
 
 std::strong_ordering big_int::compare(const bint_t& a, const bint_t& b) {
@@ -0,0 +1,97 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/bint_divisor.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/newton_division.h>
+
+#include <bit>
+#include <stdexcept>
+
+namespace {
+    bint_t checked_abs(const bint_t& a) {
+        if (a.data.size() == 1 && a.data[0] == 0)
+            throw std::invalid_argument("bint_divisor: division by zero");
+
+        bint_t result = a;
+        result.sign = false;
+        big_int_impl::normalize(result);
+        return result;
+    }
+}
+
+bint_divisor::bint_divisor(const bint_t& divisor)
+    : sign(divisor.sign), divisor(checked_abs(divisor)), shift(std::countl_zero(this->divisor.data.back())),
+      limb(this->divisor.data.size() == 1 ? this->divisor.data[0] : 1) {
+    if (this->divisor.data.size() > 1) {
+        normalized = this->divisor << shift;
+        reciprocal = std::make_shared<lazy_reciprocal>();
+    }
+}
+
+std::shared_ptr<const bint_t> bint_divisor::get_reciprocal() const {
+    {
+        std::lock_guard lock(reciprocal->mutex);
+        if (reciprocal->value != nullptr) return reciprocal->value;
+    }
+
+    auto value = std::make_shared<const bint_t>(newton_reciprocal(normalized));
+    std::lock_guard lock(reciprocal->mutex);
+    if (reciprocal->value == nullptr) reciprocal->value = std::move(value);
+    return reciprocal->value;
+}
+
+void bint_divisor::divide_abs(bint_t& a, bint_t& rem, const big_int::division_output output) const {
+    const int n = divisor.data.size();
+    if (n == 1) {
+        const uint64_t limb_rem = big_int_impl::limbs_div_1(a.data.data(), a.data.data(), a.data.size(), limb);
+        a.sign = false;
+        big_int_impl::normalize(a);
+        rem = bint_t(limb_rem);
+        return;
+    }
+
+    if (n < big_int::get_thresholds().barrett_division) {
+        big_int::divide_abs(a, divisor, rem, output);
+        return;
+    }
+
+    a.sign = false;
+    if (big_int_impl::compare_abs(a, divisor) < 0) {
+        rem = std::move(a);
+        a = bint_t(0);
+        return;
+    }
+
+    a <<= shift;
+    divide_with_reciprocal(a, normalized, *get_reciprocal(), rem, output);
+    if (output != big_int::division_output::quotient) rem >>= shift;
+}
+
+bint_t bint_divisor::divmod(const bint_t& a, bint_t& rem) const {
+    const bool negative = a.sign ^ sign;
+    bint_t quotient = a;
+    divide_abs(quotient, rem);
+    if (!big_int_impl::is_zero(rem)) {
+        if (negative) {
+            big_int_impl::add_abs_inplace(quotient, bint_t(1));
+            big_int_impl::sub_abs_reversed_inplace(rem, divisor);
+        }
+        rem.sign = sign;
+    }
+    quotient.sign = negative;
+    big_int_impl::normalize(quotient);
+    return quotient;
+}
+
+bint_t bint_divisor::mod(const bint_t& a) const {
+    bint_t quotient = a;
+    bint_t rem;
+    divide_abs(quotient, rem, big_int::division_output::remainder);
+    if (!big_int_impl::is_zero(rem)) {
+        if (a.sign != sign) big_int_impl::sub_abs_reversed_inplace(rem, divisor);
+        rem.sign = sign;
+    }
+    return rem;
+}
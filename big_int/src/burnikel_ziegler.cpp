@@ -5,6 +5,9 @@
 #include <big_int/burnikel_ziegler.h>
 #include <big_int/big_int_ops.h>
 
+#include <algorithm>
+#include <bit>
+
 bint_t get_chunk(const bint_t& a, const int chunk_size, const int chunk_index) {
     bint_t result;
     const int leftover_size = static_cast<int>(a.data.size()) - chunk_index * chunk_size;
@@ -58,7 +61,7 @@ void divide2n1n(bint_t& a, const bint_t& b, bint_t& rem) { // NOLINT(*-no-recurs
     // let a = [a1, a2, a3, a4] (a1 is the highest)
     // let b = [b1, b2] (b1 is the highest)
     const int n = b.data.size();
-    if (n % 2 != 0 || n < BURNIKEL_ZIEGLER_THRESHOLD) {
+    if (n % 2 != 0 || n < big_int::get_thresholds().burnikel_ziegler) {
         return big_int::divide_knuth_abs(a, b, rem);
     }
 
@@ -74,17 +77,17 @@ void divide2n1n(bint_t& a, const bint_t& b, bint_t& rem) { // NOLINT(*-no-recurs
     big_int_impl::add_abs_inplace(a, a4); // now a = [q1, q2]
 }
 
-void divide_burnikel_ziegler(bint_t& a, const bint_t& b, bint_t& rem) {
+void divide_burnikel_ziegler(bint_t& a, const bint_t& b, bint_t& rem, const big_int::division_output output) {
     const int r = a.data.size();
     const int s = b.data.size();
     if (r < s) {
-        rem = a;
+        rem = std::move(a);
         a = bint_t(0);
         return;
     }
 
-    // let m = min{2^k}, where 2^k * BURNIKEL_ZIEGLER_THRESHOLD > s
-    const int m = 1 << (64 - std::countl_zero(b.data.size() / BURNIKEL_ZIEGLER_THRESHOLD));
+    // let m = min{2^k}, where 2^k * threshold > s
+    const int m = 1 << (64 - std::countl_zero(b.data.size() / big_int::get_thresholds().burnikel_ziegler));
 
     const int j = (s + m - 1) / m;  // j = ceil(s / m)
     const int n = j * m;            // new length for b
@@ -92,7 +95,8 @@ void divide_burnikel_ziegler(bint_t& a, const bint_t& b, bint_t& rem) {
 
     // amount of bits to shift `a` and `b` left
     const int sigma = static_cast<int>(n64 - big_int_impl::count_bits(b));
-    const bint_t new_b = b << sigma;
+    bint_t new_b = b << sigma;
+    new_b.sign = false;
     a <<= sigma;
 
     // amount of blocks to split `a` into, but at least 2
@@ -101,17 +105,24 @@ void divide_burnikel_ziegler(bint_t& a, const bint_t& b, bint_t& rem) {
     bint_t result(0ll);
     auto z = get_chunk(a, n, t - 2);
     big_int_impl::add_abs_inplace(z, a, n * (t - 1), std::min<int>(n * t, a.data.size()), n);
+    big_int_impl::normalize(z);
     for (int i = t - 2; i >= 0; i--) {
         divide2n1n(z, new_b, rem);
-        big_int_impl::add_abs_inplace(result, z, 0, -1, n * i);
+        if (output != big_int::division_output::remainder) {
+            big_int_impl::add_abs_inplace(result, z, 0, -1, n * i);
+        }
         if (i > 0) {
             z = std::move(rem);
             z <<= n64;
             big_int_impl::add_abs_inplace(z, a, n * (i - 1), n * i);
+            // The remainder can be zero and the block of `a` can have leading zeroes
+            big_int_impl::normalize(z);
         }
     }
-    rem >>= sigma;
-    a = result;
+    if (output != big_int::division_output::quotient) {
+        rem >>= sigma;
+        big_int_impl::normalize(rem);
+    }
+    a = std::move(result);
     big_int_impl::normalize(a);
-    big_int_impl::normalize(rem);
 }
\ No newline at end of file
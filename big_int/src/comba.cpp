@@ -0,0 +1,105 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include "big_int/comba.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+using namespace big_int_impl;
+
+namespace {
+    /**
+     * Three-limb column accumulator `(c2, c1, c0)`
+     */
+    struct comba_accumulator {
+        uint64_t c0 = 0, c1 = 0, c2 = 0;
+
+        [[gnu::always_inline]] void add_product(const uint64_t x, const uint64_t y) {
+            const __uint128_t product = static_cast<__uint128_t>(x) * y;
+            const auto low = static_cast<uint64_t>(product);
+            // Can't overflow, the high limb of a product is at most 2^64 - 2
+            const uint64_t high = static_cast<uint64_t>(product >> 64) + __builtin_add_overflow(c0, low, &c0);
+            c2 += __builtin_add_overflow(c1, high, &c1);
+        }
+
+        [[gnu::always_inline]] void add_doubled(const comba_accumulator& other) {
+            const __uint128_t low = static_cast<__uint128_t>(other.c1) << 64 | other.c0;
+            const __uint128_t doubled = low << 1;
+            const __uint128_t sum = (static_cast<__uint128_t>(c1) << 64 | c0) + doubled;
+            c2 += (other.c2 << 1 | other.c1 >> 63) + (sum < doubled);
+            c0 = static_cast<uint64_t>(sum);
+            c1 = static_cast<uint64_t>(sum >> 64);
+        }
+
+        /**
+         * Returns the lowest limb and shifts the accumulator to the next column
+         */
+        [[gnu::always_inline]] uint64_t shift() {
+            const uint64_t result = c0;
+            c0 = c1;
+            c1 = c2;
+            c2 = 0;
+            return result;
+        }
+    };
+
+    template<int N, int M>
+    void comba_mul_fixed(uint64_t* r, const uint64_t* a, const uint64_t* b) {
+        comba_accumulator acc;
+#pragma GCC unroll 32
+        for (int k = 0; k < N + M - 1; k++) {
+            // Constant bounds let the compiler unroll the loop, out-of-range terms are dropped after the outer unrolling
+#pragma GCC unroll 16
+            for (int i = 0; i < N; i++) {
+                if (k - i >= 0 && k - i < M) acc.add_product(a[i], b[k - i]);
+            }
+            r[k] = acc.shift();
+        }
+        r[N + M - 1] = acc.c0;
+    }
+
+    /**
+     * Column `k` of a square: products `a[i] * a[k - i]` for `i < k - i` are accumulated once and doubled
+     */
+    template<int N>
+    void comba_square_fixed(uint64_t* r, const uint64_t* a) {
+        comba_accumulator acc;
+#pragma GCC unroll 32
+        for (int k = 0; k < 2 * N - 1; k++) {
+            comba_accumulator off_diagonal;
+#pragma GCC unroll 16
+            for (int i = 0; i < N; i++) {
+                if (k - i < N && i < k - i) off_diagonal.add_product(a[i], a[k - i]);
+            }
+            acc.add_doubled(off_diagonal);
+            if (k % 2 == 0) acc.add_product(a[k / 2], a[k / 2]);
+            r[k] = acc.shift();
+        }
+        r[2 * N - 1] = acc.c0;
+    }
+
+    using comba_mul_kernel = void (*)(uint64_t*, const uint64_t*, const uint64_t*);
+    using comba_square_kernel = void (*)(uint64_t*, const uint64_t*);
+
+    // Kernel for sizes (n, m) is at index (n - 1) * COMBA_MAX_SIZE + (m - 1)
+    constexpr auto comba_mul_table = []<int... I>(std::integer_sequence<int, I...>) {
+        return std::array<comba_mul_kernel, sizeof...(I)>{
+            &comba_mul_fixed<I / COMBA_MAX_SIZE + 1, I % COMBA_MAX_SIZE + 1>...
+        };
+    }(std::make_integer_sequence<int, COMBA_MAX_SIZE * COMBA_MAX_SIZE>{});
+
+    constexpr auto comba_square_table = []<int... I>(std::integer_sequence<int, I...>) {
+        return std::array<comba_square_kernel, sizeof...(I)>{&comba_square_fixed<I + 1>...};
+    }(std::make_integer_sequence<int, COMBA_MAX_SIZE>{});
+}
+
+void big_int_impl::comba_mul(uint64_t* r, const uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    comba_mul_table[(a_size - 1) * COMBA_MAX_SIZE + (b_size - 1)](r, a, b);
+}
+
+void big_int_impl::comba_square(uint64_t* r, const uint64_t* a, const int size) {
+    comba_square_table[size - 1](r, a);
+}
@@ -0,0 +1,151 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/conversion_cache.h>
+
+#include <bit>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    constexpr int max_radix = 36;
+    constexpr int max_level = 32;
+
+    /**
+     * Published powers are immutable, eviction replaces them with null. The mutex of an entry is held only
+     * while the pointer is copied, so threads never wait for each other's computations.
+     */
+    struct cache_entry {
+        std::mutex mutex;
+        std::shared_ptr<const bint_divisor> power;
+
+        std::shared_ptr<const bint_divisor> load() {
+            std::lock_guard lock(mutex);
+            return power;
+        }
+
+        void store(std::shared_ptr<const bint_divisor> value) {
+            std::lock_guard lock(mutex);
+            power.swap(value);
+        }
+
+        /**
+         * Publishes `value` if the entry is empty, returns the published power
+         */
+        std::shared_ptr<const bint_divisor> publish(const std::shared_ptr<const bint_divisor>& value) {
+            std::lock_guard lock(mutex);
+            if (power == nullptr) power = value;
+            return power;
+        }
+    };
+
+    cache_entry powers[max_radix + 1][max_level];
+
+    // Guards the accounting and the eviction, readers of cached powers never take it
+    std::mutex accounting_mutex;
+    size_t cached_bytes[max_radix + 1][max_level] = {};
+    size_t total_bytes = 0;
+    size_t cache_limit = size_t(256) << 20;
+
+    /**
+     * Requires `accounting_mutex`
+     */
+    void evict(const int radix, const int n) {
+        powers[radix][n].store(nullptr);
+        total_bytes -= cached_bytes[radix][n];
+        cached_bytes[radix][n] = 0;
+    }
+
+    /**
+     * Evicts the largest powers until the cache fits into the limit, requires `accounting_mutex`
+     */
+    void evict_to_limit() {
+        while (total_bytes > cache_limit) {
+            int largest_radix = 0, largest_n = 0;
+            for (int radix = 0; radix <= max_radix; radix++) {
+                for (int n = 0; n < max_level; n++) {
+                    if (cached_bytes[radix][n] > cached_bytes[largest_radix][largest_n]) {
+                        largest_radix = radix;
+                        largest_n = n;
+                    }
+                }
+            }
+            evict(largest_radix, largest_n);
+        }
+    }
+
+    /**
+     * Records the published power, unless it was already evicted
+     */
+    void account(const int radix, const int n, const std::shared_ptr<const bint_divisor>& power) {
+        // The divisor, its normalized form and the reciprocal have about the same size
+        const size_t bytes = 3 * sizeof(uint64_t) * power->value().data.size() + sizeof(bint_divisor);
+        std::lock_guard lock(accounting_mutex);
+        if (powers[radix][n].load() != power)
+            return;
+        cached_bytes[radix][n] = bytes;
+        total_bytes += bytes;
+        evict_to_limit();
+    }
+}
+
+std::shared_ptr<const bint_divisor> big_int_impl::radix_power(const int radix, const int n) { // NOLINT(*-no-recursion)
+    if (radix < 2 || radix > max_radix || n < 0 || n >= max_level) {
+        throw std::invalid_argument("radix_power: radix[" + std::to_string(radix) + "] or n[" +
+            std::to_string(n) + "] is out of range");
+    }
+
+    auto& entry = powers[radix][n];
+    if (auto power = entry.load())
+        return power;
+
+    // Missing powers are computed without waiting for other threads: a thread that waits for its parallel
+    // multiplication runs pending tasks, and one of them may need the same power
+    bint_t value = n == 0 ? bint_t(radix) : radix_power(radix, n - 1)->value();
+    if (n > 0) value *= value;
+    auto power = std::make_shared<const bint_divisor>(value);
+
+    // The first published power wins, concurrent duplicates are dropped
+    auto published = entry.publish(power);
+    if (published == power) account(radix, n, power);
+    return published;
+}
+
+// ================ namespace big_int ================
+
+void big_int::set_conversion_cache_limit(const size_t bytes) {
+    std::lock_guard lock(accounting_mutex);
+    cache_limit = bytes;
+    evict_to_limit();
+}
+
+size_t big_int::get_conversion_cache_limit() {
+    std::lock_guard lock(accounting_mutex);
+    return cache_limit;
+}
+
+size_t big_int::get_conversion_cache_size() {
+    std::lock_guard lock(accounting_mutex);
+    return total_bytes;
+}
+
+void big_int::clear_conversion_cache() {
+    std::lock_guard lock(accounting_mutex);
+    for (int radix = 0; radix <= max_radix; radix++) {
+        for (int n = 0; n < max_level; n++) {
+            evict(radix, n);
+        }
+    }
+}
+
+void big_int::prewarm_conversion_cache(const int radix, const int digits) {
+    if (radix < 2 || radix > max_radix) {
+        throw std::invalid_argument("prewarm_conversion_cache: radix[" + std::to_string(radix) + "] is not in [2, 36]");
+    }
+    // Conversions of `digits` digits split them at most at `2^n` digits, where `2^n <= digits`
+    if (!std::has_single_bit(static_cast<unsigned>(radix)) && digits > 1) {
+        big_int_impl::radix_power(radix, std::bit_width(static_cast<unsigned>(digits)) - 1);
+    }
+}
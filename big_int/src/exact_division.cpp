@@ -0,0 +1,77 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/exact_division.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/limbs.h>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /**
+     * `q = r / b mod 2^(64 k)` for odd `b`, `r` has `k` limbs and is destroyed.
+     * Every quotient limb clears the lowest remaining limb of `r`.
+     */
+    void hensel_divide(uint64_t* q, uint64_t* r, const int k, const uint64_t* b, const int b_size) {
+        const uint64_t inverse = big_int_impl::limb_inverse(b[0]);
+        for (int i = 0; i < k; i++) {
+            const uint64_t q_i = r[i] * inverse;
+            q[i] = q_i;
+            if (i + b_size < k) {
+                const uint64_t borrow = big_int_impl::limbs_submul_1(r + i, b, b_size, q_i);
+                big_int_impl::limbs_sub_inplace(r + i + b_size, k - i - b_size, &borrow, 1);
+            } else {
+                big_int_impl::limbs_submul_1(r + i, b, k - i, q_i);
+            }
+        }
+    }
+}
+
+void divide_exact(bint_t& a, const bint_t& b) {
+    if (b.data.size() == 1 && b.data[0] == 0)
+        throw std::invalid_argument("divide_exact: division by zero");
+
+    if (b.data.size() == 1) {
+        big_int_impl::limbs_divexact_1(a.data.data(), a.data.data(), a.data.size(), b.data[0]);
+        big_int_impl::normalize(a);
+        return;
+    }
+
+    // Common powers of two are shifted out, the rest of the division needs an odd divisor
+    int zero_limbs = 0;
+    while (b.data[zero_limbs] == 0) zero_limbs++;
+    const int64_t shift = 64ll * zero_limbs + std::countr_zero(b.data[zero_limbs]);
+    bint_t odd_b = b >> shift;
+    odd_b.sign = false;
+    const bool sign = a.sign;
+    a.sign = false;
+    a >>= shift;
+
+    const int b_size = odd_b.data.size();
+    const int k = static_cast<int>(a.data.size()) - b_size + 1;
+    if (k <= 0) {
+        a = bint_t(0);
+        return;
+    }
+
+    // The quadratic loop loses to the subquadratic division when both the quotient and the divisor are large
+    if (std::min(k, b_size) >= big_int::get_thresholds().divexact_via_division) {
+        bint_t rem;
+        big_int::divide_abs(a, odd_b, rem, big_int::division_output::quotient);
+        a.sign = sign;
+        big_int_impl::normalize(a);
+        return;
+    }
+
+    std::vector<uint64_t> r(a.data.begin(), a.data.begin() + k);
+    bint_t quotient;
+    quotient.data.resize(k);
+    hensel_divide(quotient.data.data(), r.data(), k, odd_b.data.data(), b_size);
+    big_int_impl::normalize(quotient);
+    quotient.sign = sign;
+    a = std::move(quotient);
+}
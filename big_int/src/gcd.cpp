@@ -0,0 +1,352 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/big_int_ops.h>
+#include <big_int/limbs.h>
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+using namespace big_int_impl;
+
+namespace {
+    /**
+     * Pair of numbers that follows the reduction of `(a, b)`: every step that replaces `(a, b)` with `M (a, b)`
+     * replaces `(x, y)` with `M (x, y)` as well. Started from the columns of the identity matrix, the pairs become
+     * the columns of the product of all steps; `(1, 0)` alone becomes the cofactors of the original `a`.
+     */
+    struct cofactor_column {
+        bint_t x;
+        bint_t y;
+    };
+
+    using cofactor_columns = std::span<cofactor_column>;
+
+    /**
+     * Product of Euclid steps with word-sized entries, `(a, b) -> (u0 a + u1 b, v0 a + v1 b)`.
+     * Entries of every row have opposite signs or one of them is zero.
+     */
+    struct lehmer_matrix {
+        int64_t u0, u1;
+        int64_t v0, v1;
+    };
+
+    /**
+     * `floor(a / 2^shift)`, requires it to be less than `2^128`
+     */
+    __uint128_t top_bits(const bint_t& a, const uint64_t shift) {
+        const int index = static_cast<int>(shift / 64);
+        const int bit = static_cast<int>(shift % 64);
+        const int size = static_cast<int>(a.data.size());
+        const auto limb = [&](const int i) { return i < size ? a.data[i] : 0; };
+        if (bit == 0) return static_cast<__uint128_t>(limb(index + 1)) << 64 | limb(index);
+        const uint64_t low = limb(index) >> bit | limb(index + 1) << (64 - bit);
+        const uint64_t high = limb(index + 1) >> bit | limb(index + 2) << (64 - bit);
+        return static_cast<__uint128_t>(high) << 64 | low;
+    }
+
+    /**
+     * `n / d` for `n, d >= 0`, most quotients of the Euclid steps are small enough to be found by subtractions
+     */
+    __int128 euclid_quotient(__int128 n, const __int128 d) {
+        if (n >> 2 >= d) return n / d;
+        __int128 quotient = 0;
+        while (n >= d) {
+            n -= d;
+            quotient++;
+        }
+        return quotient;
+    }
+
+    /**
+     * Lehmer's step with double-digit leading parts (Knuth, TAOCP 4.5.2, algorithm L). Euclid steps are run on
+     * the leading 126 bits of `a >= b` while the quotients for both ends of the interval of possible values agree,
+     * so every found quotient is a quotient of the full numbers. Short numbers are run exactly. The entries are
+     * bounded by `2^62`, so one step removes about 62 bits. Returns the identity if not even the first quotient is known.
+     */
+    lehmer_matrix find_lehmer_matrix(const bint_t& a, const bint_t& b) {
+        constexpr __int128 limit = static_cast<__int128>(1) << 62;
+        const uint64_t bits = count_bits(a);
+        const uint64_t shift = bits > 126 ? bits - 126 : 0;
+        const bool exact = shift == 0;
+        __int128 x = top_bits(a, shift), y = top_bits(b, shift);
+        __int128 u0 = 1, u1 = 0, v0 = 0, v1 = 1;
+        while (true) {
+            __int128 quotient;
+            if (exact) {
+                if (y == 0) break;
+                quotient = euclid_quotient(x, y);
+            } else {
+                if (y + v0 == 0 || y + v1 == 0) break;
+                quotient = euclid_quotient(x + u0, y + v0);
+                if (quotient != euclid_quotient(x + u1, y + v1)) break;
+            }
+            if (quotient >= limit) break;
+            const __int128 next_v0 = u0 - quotient * v0;
+            const __int128 next_v1 = u1 - quotient * v1;
+            if (next_v0 <= -limit || next_v0 >= limit || next_v1 <= -limit || next_v1 >= limit) break;
+            u0 = std::exchange(v0, next_v0);
+            u1 = std::exchange(v1, next_v1);
+            x = std::exchange(y, x - quotient * y);
+        }
+        return {static_cast<int64_t>(u0), static_cast<int64_t>(u1), static_cast<int64_t>(v0), static_cast<int64_t>(v1)};
+    }
+
+    /**
+     * `r[0..n-1] = x * u + y * v` for `u` and `v` of opposite signs or zero, the result must be nonnegative and fit
+     * into `n` limbs
+     */
+    void combine_limbs(uint64_t* r, const uint64_t* x, int64_t u, const uint64_t* y, int64_t v, const int n) {
+        if (u < 0 || v > 0) {
+            std::swap(x, y);
+            std::swap(u, v);
+        }
+        limbs_mul_1(r, x, n, static_cast<uint64_t>(u));
+        limbs_submul_1(r, y, n, static_cast<uint64_t>(-v));
+    }
+
+    /**
+     * `r += x * k` for a signed `k`
+     */
+    void add_scaled(bint_t& r, const bint_t& x, const int64_t k) {
+        if (k >= 0) {
+            big_int::addmul(r, x, static_cast<uint64_t>(k));
+        } else {
+            big_int::submul(r, x, static_cast<uint64_t>(-k));
+        }
+    }
+
+    /**
+     * `(a, b) = (b, a mod b)`
+     */
+    void division_step(bint_t& a, bint_t& b, const cofactor_columns columns) {
+        bint_t rem;
+        big_int::divide_abs(a, b, rem, columns.empty()
+            ? big_int::division_output::remainder
+            : big_int::division_output::quotient_and_remainder);
+        for (auto& [x, y] : columns) {
+            big_int::submul(x, y, a);
+            std::swap(x, y);
+        }
+        a = std::move(b);
+        b = std::move(rem);
+    }
+
+    /**
+     * One Lehmer step for `a >= b > 0`, or one division step if the leading parts don't determine the quotient
+     */
+    void lehmer_step(bint_t& a, bint_t& b, const cofactor_columns columns) {
+        const lehmer_matrix m = find_lehmer_matrix(a, b);
+        if (m.u1 == 0) {
+            division_step(a, b, columns);
+            return;
+        }
+
+        const int n = static_cast<int>(a.data.size());
+        b.data.resize(n);
+        bint_t new_a, new_b;
+        new_a.data.resize(n);
+        new_b.data.resize(n);
+        combine_limbs(new_a.data.data(), a.data.data(), m.u0, b.data.data(), m.u1, n);
+        combine_limbs(new_b.data.data(), a.data.data(), m.v0, b.data.data(), m.v1, n);
+        normalize(new_a);
+        normalize(new_b);
+        a = std::move(new_a);
+        b = std::move(new_b);
+
+        for (auto& [x, y] : columns) {
+            bint_t new_x(0), new_y(0);
+            add_scaled(new_x, x, m.u0);
+            add_scaled(new_x, y, m.u1);
+            add_scaled(new_y, x, m.v0);
+            add_scaled(new_y, y, m.v1);
+            x = std::move(new_x);
+            y = std::move(new_y);
+        }
+    }
+
+    /**
+     * Lehmer steps for `a >= b` until `b` has at most `size` limbs
+     */
+    void lehmer_reduce(bint_t& a, bint_t& b, const cofactor_columns columns, const int size) {
+        while (static_cast<int>(b.data.size()) > size) {
+            lehmer_step(a, b, columns);
+        }
+    }
+
+    void half_gcd(bint_t& a, bint_t& b, cofactor_columns columns);
+
+    /**
+     * Reduces `a >= b` with the matrix that the half-GCD finds for their limbs above the lowest `p`.
+     * `M (a, b) = 2^(64 p) M (a_high, b_high) + M (a_low, b_low)`, so only the low parts are multiplied by the matrix.
+     * The leading parts only approximate the numbers, so the last steps of the matrix may be wrong and turn a result
+     * negative or swap their order: such rows are negated or swapped. The matrix stays unimodular, so the GCD and
+     * the cofactors are correct anyway, and the numbers are still reduced by about as much as their leading parts.
+     */
+    void reduce_by_leading_part(bint_t& a, bint_t& b, const cofactor_columns columns, const int p) {
+        bint_t high_a = a >> 64 * p;
+        bint_t high_b = b >> 64 * p;
+        cofactor_column m[2] = {{bint_t(1), bint_t(0)}, {bint_t(0), bint_t(1)}};
+        half_gcd(high_a, high_b, m);
+        if (is_zero(m[0].y) && is_zero(m[1].x))
+            return;
+
+        const auto low_part = [p](const bint_t& value) {
+            bint_t low;
+            low.sign = false;
+            low.data.assign(value.data.begin(), value.data.begin() + std::min<int>(p, value.data.size()));
+            normalize(low);
+            return low;
+        };
+        const bint_t low_a = low_part(a);
+        const bint_t low_b = low_part(b);
+        a = std::move(high_a) << 64 * p;
+        big_int::addmul(a, m[0].x, low_a);
+        big_int::addmul(a, m[1].x, low_b);
+        b = std::move(high_b) << 64 * p;
+        big_int::addmul(b, m[0].y, low_a);
+        big_int::addmul(b, m[1].y, low_b);
+
+        if (a.sign) {
+            a.sign = false;
+            m[0].x = -m[0].x;
+            m[1].x = -m[1].x;
+        }
+        if (b.sign) {
+            b.sign = false;
+            m[0].y = -m[0].y;
+            m[1].y = -m[1].y;
+        }
+        if (compare_abs(a, b) < 0) {
+            std::swap(a, b);
+            std::swap(m[0].x, m[0].y);
+            std::swap(m[1].x, m[1].y);
+        }
+
+        for (auto& [x, y] : columns) {
+            bint_t new_x = m[0].x * x;
+            big_int::addmul(new_x, m[1].x, y);
+            bint_t new_y = m[0].y * x;
+            big_int::addmul(new_y, m[1].y, y);
+            x = std::move(new_x);
+            y = std::move(new_y);
+        }
+    }
+
+    /**
+     * Reduces `a >= b` of `n` limbs until `b` has at most `n / 2 + 2` limbs (Schönhage, Möller). The first half of
+     * the reduction is found recursively from the leading `n / 2` limbs, the second one from the leading limbs of
+     * the reduced numbers, a few Lehmer steps finish it. Short numbers are reduced by Lehmer steps only.
+     */
+    void half_gcd(bint_t& a, bint_t& b, const cofactor_columns columns) { // NOLINT(*-no-recursion)
+        const int n = static_cast<int>(a.data.size());
+        const int s = n / 2 + 1;
+        if (static_cast<int>(b.data.size()) <= s + 1)
+            return;
+        if (n < big_int::get_thresholds().hgcd) {
+            lehmer_reduce(a, b, columns, s + 1);
+            return;
+        }
+
+        reduce_by_leading_part(a, b, columns, n / 2);
+        if (static_cast<int>(b.data.size()) > s + 1) {
+            // The leading `2 (m - s)` limbs are reduced by about `m - s` limbs, down to `s`
+            const int m = static_cast<int>(a.data.size());
+            reduce_by_leading_part(a, b, columns, std::max(1, 2 * s - m));
+        }
+        lehmer_reduce(a, b, columns, s + 1);
+    }
+
+    /**
+     * Reduces `a >= b >= 0` to `(gcd(a, b), 0)`
+     */
+    void reduce_to_gcd(bint_t& a, bint_t& b, const cofactor_columns columns) {
+        const int threshold = big_int::get_thresholds().hgcd;
+        while (!is_zero(b)) {
+            const int n = static_cast<int>(a.data.size());
+            if (static_cast<int>(b.data.size()) + 1 < n) {
+                // Operands of different lengths are balanced by a single division
+                division_step(a, b, columns);
+            } else if (n >= threshold && static_cast<int>(b.data.size()) > n / 2 + 2) {
+                half_gcd(a, b, columns);
+            } else {
+                lehmer_step(a, b, columns);
+            }
+        }
+    }
+
+    /**
+     * `|a|` and `|b|` ordered by magnitude, returns `true` if they were swapped
+     */
+    bool ordered_magnitudes(const bint_t& a, const bint_t& b, bint_t& larger, bint_t& smaller) {
+        const bool swapped = compare_abs(a, b) < 0;
+        larger = swapped ? b : a;
+        smaller = swapped ? a : b;
+        larger.sign = false;
+        smaller.sign = false;
+        return swapped;
+    }
+}
+
+bint_t big_int::gcd(const bint_t& a, const bint_t& b) {
+    bint_t x, y;
+    ordered_magnitudes(a, b, x, y);
+    if (x.data.size() == 1)
+        return bint_t(std::gcd(x.data[0], y.data[0]));
+    reduce_to_gcd(x, y, {});
+    return x;
+}
+
+bint_t big_int::gcdext(const bint_t& a, const bint_t& b, bint_t& s, bint_t& t) {
+    if (is_zero(b)) {
+        s = bint_t(is_zero(a) ? 0 : a.sign ? -1 : 1);
+        t = bint_t(0);
+        bint_t g = a;
+        g.sign = false;
+        return g;
+    }
+
+    bint_t x, y;
+    const bool swapped = ordered_magnitudes(a, b, x, y);
+    cofactor_column column{bint_t(1), bint_t(0)};
+    reduce_to_gcd(x, y, {&column, 1});
+    bint_t g = std::move(x);
+
+    // `column.x` is the cofactor of the larger operand, the cofactor of `a` is derived from it and reduced modulo `|b| / g`
+    bint_t a_cofactor;
+    if (!swapped) {
+        a_cofactor = std::move(column.x);
+        if (a.sign) a_cofactor = -a_cofactor;
+    } else if (is_zero(a)) {
+        a_cofactor = bint_t(0);
+    } else {
+        bint_t b_cofactor = std::move(column.x);
+        if (b.sign) b_cofactor = -b_cofactor;
+        a_cofactor = divexact(g - b * b_cofactor, a);
+    }
+    bint_t b_over_g = divexact(b, g);
+    b_over_g.sign = false;
+    a_cofactor %= b_over_g;
+    t = divexact(g - a * a_cofactor, b);
+    s = std::move(a_cofactor);
+    return g;
+}
+
+bint_t big_int::modinv(const bint_t& a, const bint_t& mod) {
+    if (mod.sign || is_zero(mod)) {
+        throw std::invalid_argument("modinv: mod must be positive");
+    }
+    bint_t x = mod;
+    bint_t y = a % mod;
+    // The cofactor of `a` follows the second column
+    cofactor_column column{bint_t(0), bint_t(1)};
+    reduce_to_gcd(x, y, {&column, 1});
+    if (x != bint_t(1)) {
+        throw std::invalid_argument("modinv: a is not invertible modulo mod");
+    }
+    return column.x % mod;
+}
@@ -4,75 +4,122 @@
 
 #include "big_int/karatsuba.h"
 #include "big_int/big_int_ops.h"
+#include "big_int/limbs.h"
+#include "big_int/thread_pool.h"
 
-using namespace big_int_impl;
-
-std::pair<bint_t, int> split_abs(const bint_t& a, int m, int a_limit) {
-    if (a_limit <= m)
-        return std::make_pair(bint_t(0ll), a_limit);
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
-    bint_t high;
-    high.data.resize(a_limit - m);
-    std::copy_n(a.data.begin() + m, a_limit - m, high.data.begin());
-    return std::make_pair(high, m);
-}
+using namespace big_int_impl;
 
-bint_t split_abs_inplace(bint_t& a, const int m, int a_limit) {
-    if (a_limit <= m) {
-        throw std::runtime_error("split_abs_inplace: a_limit [" + std::to_string(a_limit) +
-            "] <= m [" + std::to_string(2 * m) + "]");
+/**
+ * Subtractive Karatsuba: `a * b = z0 + (z0 + z2 - (a0 - a1) * (b0 - b1)) * B^m + z2 * B^(2m)`,
+ * where `z0 = a0 * b0` and `z2 = a1 * b1`. Differences keep all three products of size `m`.
+ * Scratch layout: [|a0 - a1| : m][|b0 - b1| : m][product of differences : 2m][recursion or middle sum]
+ */
+void karatsuba_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 1) / 2;
+    const int k = n - m;
+
+    uint64_t* da = scratch;
+    uint64_t* db = da + m;
+    uint64_t* d_product = db + m;
+    uint64_t* next = d_product + 2 * m;
+
+    const bool da_neg = limbs_abs_diff(da, a, m, a + m, k);
+    const bool db_neg = limbs_abs_diff(db, b, m, b + m, k);
+    if (thread_pool* pool = parallel_pool(n)) {
+        // Products write disjoint ranges, only one of them may use the shared recursion scratch
+        parallel_invoke(*pool,
+            [=] { limbs_mul_n(d_product, da, db, m, next); },
+            [=] { limbs_mul_n_alloc(r, a, b, m); },
+            [=] { limbs_mul_n_alloc(r + 2 * m, a + m, b + m, k); });
+    } else {
+        limbs_mul_n(d_product, da, db, m, next);
+        limbs_mul_n(r, a, b, m, next);
+        limbs_mul_n(r + 2 * m, a + m, b + m, k, next);
     }
 
-    bint_t high;
-    high.data.resize(a_limit - m);
-    std::copy_n(a.data.begin() + m, a_limit - m, high.data.begin());
-    normalize(high);
+    // The recursion is over, reuse its scratch for the middle sum of 2m + 1 limbs
+    uint64_t* middle = next;
+    middle[2 * m] = limbs_add(middle, r, 2 * m, r + 2 * m, 2 * k);
+    if (da_neg == db_neg) {
+        limbs_sub(middle, middle, 2 * m + 1, d_product, 2 * m);
+    } else {
+        limbs_add(middle, middle, 2 * m + 1, d_product, 2 * m);
+    }
 
-    a.sign = false;
-    a.data.resize(m);
-    normalize(a);
-    return high;
+    if (limbs_add_inplace(r + m, 2 * n - m, middle, std::min(2 * m + 1, 2 * n - m)) != 0)
+        throw std::runtime_error("karatsuba_mul_n: carry out of the result");
 }
 
-bint_t karatsuba(const bint_t& a, const bint_t& b, int a_limit, int b_limit) { // NOLINT(*-no-recursion)
-    if (a_limit < 0) a_limit = a.data.size();
-    if (b_limit < 0) b_limit = b.data.size();
+/**
+ * Same as `karatsuba_mul_n`, the middle part is `z0 + z2 - (a0 - a1)^2`
+ */
+void karatsuba_square_n(uint64_t* r, const uint64_t* a, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 1) / 2;
+    const int k = n - m;
+
+    uint64_t* da = scratch;
+    uint64_t* d_square = da + m;
+    uint64_t* next = d_square + 2 * m;
+
+    limbs_abs_diff(da, a, m, a + m, k);
+    if (thread_pool* pool = parallel_pool(n)) {
+        parallel_invoke(*pool,
+            [=] { limbs_square_n(d_square, da, m, next); },
+            [=] { limbs_square_n_alloc(r, a, m); },
+            [=] { limbs_square_n_alloc(r + 2 * m, a + m, k); });
+    } else {
+        limbs_square_n(d_square, da, m, next);
+        limbs_square_n(r, a, m, next);
+        limbs_square_n(r + 2 * m, a + m, k, next);
+    }
 
-    const int m = (std::max(a_limit, b_limit) + 1) / 2;
-    auto [a1, a0_limit] = split_abs(a, m, a_limit);
-    auto [b1, b0_limit] = split_abs(b, m, b_limit);
+    uint64_t* middle = next;
+    middle[2 * m] = limbs_add(middle, r, 2 * m, r + 2 * m, 2 * k);
+    limbs_sub(middle, middle, 2 * m + 1, d_square, 2 * m);
 
-    auto z2 = big_int::multiply(a1, b1);
-    auto z0 = big_int::multiply(a, b, a0_limit, b0_limit);
-    add_abs_inplace(a1, a, 0, a0_limit);
-    add_abs_inplace(b1, b, 0, b0_limit);
-    auto z1 = big_int::multiply(a1, b1);
-    sub_abs_inplace(z1, z2);
-    sub_abs_inplace(z1, z0);
+    if (limbs_add_inplace(r + m, 2 * n - m, middle, std::min(2 * m + 1, 2 * n - m)) != 0)
+        throw std::runtime_error("karatsuba_square_n: carry out of the result");
+}
 
-    add_abs_inplace(z0, z1, 0, -1, m);
-    add_abs_inplace(z0, z2, 0, -1, 2 * m);
-    z0.sign = a.sign ^ b.sign;
-    normalize(z0);
+int karatsuba_mul_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 1) / 2;
+    return 4 * m + std::max({limbs_mul_scratch_size(m), limbs_mul_scratch_size(n - m), 2 * m + 1});
+}
 
-    return z0;
+int karatsuba_square_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 1) / 2;
+    return 3 * m + std::max({limbs_square_scratch_size(m), limbs_square_scratch_size(n - m), 2 * m + 1});
 }
 
-void karatsuba_square(bint_t& a, int a_limit) { // NOLINT(*-no-recursion)
+bint_t karatsuba(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
     if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
 
-    const int m = (a_limit + 1) / 2;
-    auto a1 = split_abs_inplace(a, m, a_limit);
+    // One scratch buffer for the whole recursion: [padded a : n][padded b : n][recursion]
+    const int n = std::max(a_limit, b_limit);
+    std::vector<uint64_t> scratch(2 * n + karatsuba_mul_scratch_size(n));
+    const uint64_t* a_limbs = limbs_padded(a, a_limit, n, scratch.data());
+    const uint64_t* b_limbs = limbs_padded(b, b_limit, n, scratch.data() + n);
+
+    bint_t result;
+    result.data.resize(2 * n);
+    karatsuba_mul_n(result.data.data(), a_limbs, b_limbs, n, scratch.data() + 2 * n);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
+}
 
-    auto z2 = a1;
-    square(z2);
-    add_abs_inplace(a1, a);
-    square(a);
-    square(a1);
-    sub_abs_inplace(a1, z2);
-    sub_abs_inplace(a1, a);
+void karatsuba_square(bint_t& a, int a_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
 
-    add_abs_inplace(a, a1, 0, -1, m);
-    add_abs_inplace(a, z2, 0, -1, 2 * m);
+    std::vector<uint64_t> scratch(karatsuba_square_scratch_size(a_limit));
+    bint_t result;
+    result.data.resize(2 * a_limit);
+    karatsuba_square_n(result.data.data(), a.data.data(), a_limit, scratch.data());
+    a = std::move(result);
     normalize(a);
 }
@@ -0,0 +1,390 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include "big_int/limbs.h"
+#include "big_int/big_int_ops.h"
+#include "big_int/comba.h"
+#include "big_int/karatsuba.h"
+#include "big_int/limbs_x86_64.h"
+#include "big_int/toom_cook.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+uint64_t big_int_impl::limbs_add(uint64_t* r, const uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    uint64_t carry = 0;
+    int i = 0;
+    for (; i < b_size; i++) {
+        uint64_t c;
+        const bool overflow1 = __builtin_add_overflow(a[i], b[i], &c);
+        const bool overflow2 = __builtin_add_overflow(c, carry, &c);
+        r[i] = c;
+        carry = overflow1 | overflow2;
+    }
+    for (; i < a_size; i++) {
+        carry = __builtin_add_overflow(a[i], carry, &r[i]);
+    }
+    return carry;
+}
+
+uint64_t big_int_impl::limbs_sub(uint64_t* r, const uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    uint64_t borrow = 0;
+    int i = 0;
+    for (; i < b_size; i++) {
+        uint64_t c;
+        const bool overflow1 = __builtin_sub_overflow(a[i], b[i], &c);
+        const bool overflow2 = __builtin_sub_overflow(c, borrow, &c);
+        r[i] = c;
+        borrow = overflow1 | overflow2;
+    }
+    for (; i < a_size; i++) {
+        borrow = __builtin_sub_overflow(a[i], borrow, &r[i]);
+    }
+    return borrow;
+}
+
+uint64_t big_int_impl::limbs_add_inplace(uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    uint64_t carry = limbs_add(a, a, b_size, b, b_size);
+    for (int i = b_size; i < a_size && carry > 0; i++) {
+        carry = __builtin_add_overflow(a[i], carry, &a[i]);
+    }
+    return carry;
+}
+
+uint64_t big_int_impl::limbs_sub_inplace(uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    uint64_t borrow = limbs_sub(a, a, b_size, b, b_size);
+    for (int i = b_size; i < a_size && borrow > 0; i++) {
+        borrow = __builtin_sub_overflow(a[i], borrow, &a[i]);
+    }
+    return borrow;
+}
+
+int big_int_impl::limbs_compare(const uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    for (int i = a_size - 1; i >= b_size; i--) {
+        if (a[i] != 0) return 1;
+    }
+    for (int i = b_size - 1; i >= a_size; i--) {
+        if (b[i] != 0) return -1;
+    }
+    for (int i = std::min(a_size, b_size) - 1; i >= 0; i--) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+bool big_int_impl::limbs_abs_diff(uint64_t* r, const uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    const int size = std::max(a_size, b_size);
+    const int common_size = std::min(a_size, b_size);
+    if (limbs_compare(a, a_size, b, b_size) >= 0) {
+        // High limbs of `b` above `a_size` are zero here
+        limbs_sub(r, a, a_size, b, common_size);
+        std::fill(r + a_size, r + size, 0);
+        return false;
+    }
+
+    limbs_sub(r, b, b_size, a, common_size);
+    std::fill(r + b_size, r + size, 0);
+    return true;
+}
+
+bool big_int_impl::limbs_add_signed(uint64_t* r, const uint64_t* a, const bool a_neg,
+                                    const uint64_t* b, const int b_size, const bool b_neg, const int size) {
+    if (a_neg == b_neg) {
+        limbs_add(r, a, size, b, b_size);
+        return a_neg;
+    }
+
+    const int cmp = limbs_compare(a, size, b, b_size);
+    if (cmp == 0) {
+        std::fill_n(r, size, 0);
+        return false;
+    }
+    if (cmp > 0) {
+        limbs_sub(r, a, size, b, b_size);
+        return a_neg;
+    }
+
+    // High limbs of `a` above `b_size` are zero here
+    limbs_sub(r, b, b_size, a, b_size);
+    std::fill(r + b_size, r + size, 0);
+    return b_neg;
+}
+
+uint64_t big_int_impl::limbs_shift_left(uint64_t* r, const uint64_t* a, const int size, const int shift) {
+    const uint64_t out = a[size - 1] >> (64 - shift);
+    for (int i = size - 1; i > 0; i--) {
+        r[i] = a[i] << shift | a[i - 1] >> (64 - shift);
+    }
+    r[0] = a[0] << shift;
+    return out;
+}
+
+uint64_t big_int_impl::limbs_shift_right(uint64_t* r, const uint64_t* a, const int size, const int shift) {
+    const uint64_t out = a[0] << (64 - shift);
+    for (int i = 0; i < size - 1; i++) {
+        r[i] = a[i] >> shift | a[i + 1] << (64 - shift);
+    }
+    r[size - 1] = a[size - 1] >> shift;
+    return out;
+}
+
+uint64_t big_int_impl::limbs_div_1(uint64_t* r, const uint64_t* a, const int size, const uint64_t b) {
+    if (size == 1) {
+        r[0] = a[0] / b;
+        return a[0] % b;
+    }
+    return limbs_div_1(r, a, size, limb_divisor(b));
+}
+
+uint64_t big_int_impl::limbs_div_1(uint64_t* r, const uint64_t* a, const int size, const limb_divisor& b) {
+    if (size == 0)
+        return 0;
+
+    const int shift = b.shift;
+    uint64_t rem = 0;
+    if (shift == 0) {
+        for (int i = size - 1; i >= 0; i--) {
+            r[i] = b.divide_normalized(rem, a[i], rem);
+        }
+        return rem;
+    }
+
+    // Divide `a << shift` by the normalized divisor, the remainder is shifted back
+    rem = a[size - 1] >> (64 - shift);
+    for (int i = size - 1; i > 0; i--) {
+        r[i] = b.divide_normalized(rem, a[i] << shift | a[i - 1] >> (64 - shift), rem);
+    }
+    r[0] = b.divide_normalized(rem, a[0] << shift, rem);
+    return rem >> shift;
+}
+
+uint64_t big_int_impl::limbs_divexact_1(uint64_t* r, const uint64_t* a, const int size, uint64_t b) {
+    if (size == 0)
+        return 0;
+
+    // b = odd * 2^shift, the quotient of `a` by the odd part is shifted right, its lowest bits must be zero
+    const int shift = std::countr_zero(b);
+    b >>= shift;
+    const uint64_t inverse = limb_inverse(b);
+
+    // q_i b = a_i - borrow_i + borrow_(i+1) 2^64, so that q b = a + borrow 2^(64 size) after the last limb
+    uint64_t borrow = 0;
+    for (int i = 0; i < size; i++) {
+        const uint64_t limb = a[i];
+        const uint64_t difference = limb - borrow;
+        const uint64_t q = difference * inverse;
+        borrow = static_cast<uint64_t>(static_cast<__uint128_t>(q) * b >> 64) + (limb < borrow);
+        r[i] = q;
+    }
+
+    if (shift == 0)
+        return borrow;
+
+    const uint64_t low_bits = r[0] & ((1ull << shift) - 1);
+    limbs_shift_right(r, r, size, shift);
+    return borrow | low_bits;
+}
+
+void big_int_impl::limbs_div_1_chained(uint64_t* r, const uint64_t* a, const int size, const limb_divisor& b,
+                                       uint64_t* rems, const int count) {
+    if (b.shift != 0) throw std::runtime_error("limbs_div_1_chained: divisor is not normalized");
+
+    std::fill_n(rems, count, 0);
+    for (int i = size - 1; i >= 0; i--) {
+        uint64_t limb = a[i];
+        for (int j = 0; j < count; j++) {
+            limb = b.divide_normalized(rems[j], limb, rems[j]);
+        }
+        r[i] = limb;
+    }
+}
+
+namespace {
+    uint64_t limbs_mul_1_generic(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+        const __uint128_t factor = b;
+        uint64_t carry = 0;
+        for (int i = 0; i < n; i++) {
+            const __uint128_t c = factor * a[i] + carry;
+            r[i] = static_cast<uint64_t>(c);
+            carry = static_cast<uint64_t>(c >> 64);
+        }
+        return carry;
+    }
+
+    uint64_t limbs_addmul_1_generic(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+        const __uint128_t factor = b;
+        uint64_t carry = 0;
+        for (int i = 0; i < n; i++) {
+            __uint128_t c = carry;
+            c += factor * a[i];
+            c += r[i];
+            r[i] = static_cast<uint64_t>(c);
+            carry = static_cast<uint64_t>(c >> 64);
+        }
+        return carry;
+    }
+
+    uint64_t limbs_submul_1_generic(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+        const __uint128_t factor = b;
+        uint64_t borrow = 0;
+        for (int i = 0; i < n; i++) {
+            const __uint128_t product = factor * a[i] + borrow;
+            const auto low = static_cast<uint64_t>(product);
+            borrow = static_cast<uint64_t>(product >> 64) + (r[i] < low);
+            r[i] -= low;
+        }
+        return borrow;
+    }
+
+    /**
+     * Implementations of the multiply-accumulate kernels, chosen once at runtime by the CPU features
+     */
+    struct mul_1_kernels {
+        uint64_t (*mul_1)(uint64_t*, const uint64_t*, int, uint64_t);
+        uint64_t (*addmul_1)(uint64_t*, const uint64_t*, int, uint64_t);
+        uint64_t (*submul_1)(uint64_t*, const uint64_t*, int, uint64_t);
+        // Comba products beat rows of `addmul_1` only up to this number of limb products
+        int comba_mul_max_products;
+    };
+
+    mul_1_kernels select_mul_1_kernels() {
+#if defined(__x86_64__)
+        if (big_int_impl::cpu_supports_mulx_adx()) {
+            using namespace big_int_impl;
+            // Rows with two carry chains win over Comba columns starting from about 8x8 limbs
+            return {limbs_mul_1_adx, limbs_addmul_1_adx, limbs_submul_1_adx, 64};
+        }
+#endif
+        return {limbs_mul_1_generic, limbs_addmul_1_generic, limbs_submul_1_generic,
+                big_int_impl::COMBA_MAX_SIZE * big_int_impl::COMBA_MAX_SIZE};
+    }
+
+    const mul_1_kernels& get_mul_1_kernels() {
+        // Function-local static, so that kernels are ready during the static initialization of other units
+        static const mul_1_kernels kernels = select_mul_1_kernels();
+        return kernels;
+    }
+}
+
+uint64_t big_int_impl::limbs_mul_1(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+    return get_mul_1_kernels().mul_1(r, a, n, b);
+}
+
+uint64_t big_int_impl::limbs_addmul_1(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+    return get_mul_1_kernels().addmul_1(r, a, n, b);
+}
+
+uint64_t big_int_impl::limbs_submul_1(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+    return get_mul_1_kernels().submul_1(r, a, n, b);
+}
+
+void big_int_impl::limbs_mul_basecase(uint64_t* r, const uint64_t* a, const int a_size, const uint64_t* b, const int b_size) {
+    if (b_size == 0) {
+        std::fill_n(r, a_size, 0);
+        return;
+    }
+
+    const auto& kernels = get_mul_1_kernels();
+    if (a_size > 0 && a_size <= COMBA_MAX_SIZE && b_size <= COMBA_MAX_SIZE && a_size * b_size <= kernels.comba_mul_max_products)
+        return comba_mul(r, a, a_size, b, b_size);
+
+    r[a_size] = kernels.mul_1(r, a, a_size, b[0]);
+    for (int i = 1; i < b_size; i++) {
+        r[a_size + i] = kernels.addmul_1(r + i, a, a_size, b[i]);
+    }
+}
+
+void big_int_impl::limbs_square_basecase(uint64_t* r, const uint64_t* a, const int size) {
+    if (size > 0 && size <= COMBA_MAX_SIZE)
+        return comba_square(r, a, size);
+
+    // Off-diagonal products a[i] * a[j] for i < j
+    std::fill_n(r, 2 * size, 0);
+    const auto& kernels = get_mul_1_kernels();
+    for (int i = 0; i < size - 1; i++) {
+        r[i + size] = kernels.addmul_1(r + 2 * i + 1, a + i + 1, size - i - 1, a[i]);
+    }
+
+    // Double them and add the diagonal a[i]^2
+    limbs_shift_left(r, r, 2 * size, 1);
+    uint64_t carry = 0;
+    for (int i = 0; i < size; i++) {
+        const __uint128_t diagonal = static_cast<__uint128_t>(a[i]) * a[i];
+        __uint128_t c = static_cast<__uint128_t>(r[2 * i]) + static_cast<uint64_t>(diagonal) + carry;
+        r[2 * i] = static_cast<uint64_t>(c);
+        c = (c >> 64) + r[2 * i + 1] + static_cast<uint64_t>(diagonal >> 64);
+        r[2 * i + 1] = static_cast<uint64_t>(c);
+        carry = static_cast<uint64_t>(c >> 64);
+    }
+}
+
+void big_int_impl::limbs_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const auto& thresholds = big_int::get_thresholds();
+    if (n < thresholds.karatsuba)
+        return limbs_mul_basecase(r, a, n, b, n);
+
+    if (n < thresholds.toom_cook)
+        return karatsuba_mul_n(r, a, b, n, scratch);
+
+    if (n < thresholds.toom_4)
+        return toom3_mul_n(r, a, b, n, scratch);
+
+    if (n < thresholds.toom_6h)
+        return toom4_mul_n(r, a, b, n, scratch);
+
+    toom6h_mul_n(r, a, b, n, scratch);
+}
+
+void big_int_impl::limbs_square_n(uint64_t* r, const uint64_t* a, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const auto& thresholds = big_int::get_thresholds();
+    if (n < thresholds.karatsuba_square)
+        return limbs_square_basecase(r, a, n);
+
+    if (n < thresholds.toom_cook_square)
+        return karatsuba_square_n(r, a, n, scratch);
+
+    if (n < thresholds.toom_4_square)
+        return toom3_square_n(r, a, n, scratch);
+
+    if (n < thresholds.toom_6h_square)
+        return toom4_square_n(r, a, n, scratch);
+
+    toom6h_square_n(r, a, n, scratch);
+}
+
+int big_int_impl::limbs_mul_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const auto& thresholds = big_int::get_thresholds();
+    if (n < thresholds.karatsuba) return 0;
+    if (n < thresholds.toom_cook) return karatsuba_mul_scratch_size(n);
+    if (n < thresholds.toom_4) return toom3_mul_scratch_size(n);
+    if (n < thresholds.toom_6h) return toom4_mul_scratch_size(n);
+    return toom6h_mul_scratch_size(n);
+}
+
+int big_int_impl::limbs_square_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const auto& thresholds = big_int::get_thresholds();
+    if (n < thresholds.karatsuba_square) return 0;
+    if (n < thresholds.toom_cook_square) return karatsuba_square_scratch_size(n);
+    if (n < thresholds.toom_4_square) return toom3_square_scratch_size(n);
+    if (n < thresholds.toom_6h_square) return toom4_square_scratch_size(n);
+    return toom6h_square_scratch_size(n);
+}
+
+void big_int_impl::limbs_mul_n_alloc(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n) {
+    std::vector<uint64_t> scratch(limbs_mul_scratch_size(n));
+    limbs_mul_n(r, a, b, n, scratch.data());
+}
+
+void big_int_impl::limbs_square_n_alloc(uint64_t* r, const uint64_t* a, const int n) {
+    std::vector<uint64_t> scratch(limbs_square_scratch_size(n));
+    limbs_square_n(r, a, n, scratch.data());
+}
+
+const uint64_t* big_int_impl::limbs_padded(const bint_t& a, const int a_limit, const int n, uint64_t* buffer) {
+    if (a_limit == n) return a.data.data();
+    std::copy_n(a.data.begin(), a_limit, buffer);
+    std::fill(buffer + a_limit, buffer + n, 0);
+    return buffer;
+}
@@ -0,0 +1,174 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include "big_int/limbs_x86_64.h"
+
+#if defined(__x86_64__)
+
+#include <cpuid.h>
+
+/*
+ * Every kernel processes blocks of 4 limbs in assembly and the remaining `n % 4` limbs in C++.
+ * Flags are reset in the beginning of each block and both carry chains are folded into the carry limb
+ * in its end, so the loop counter may use `dec`, which breaks OF.
+ */
+
+bool big_int_impl::cpu_supports_mulx_adx() {
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return false;
+
+    constexpr unsigned bmi2_bit = 1u << 8;
+    constexpr unsigned adx_bit = 1u << 19;
+    return (ebx & bmi2_bit) != 0 && (ebx & adx_bit) != 0;
+}
+
+uint64_t big_int_impl::limbs_mul_1_adx(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+    uint64_t carry = 0;
+    if (long blocks = n / 4; blocks > 0) {
+        uint64_t* rp = r;
+        const uint64_t* ap = a;
+        uint64_t t0, t1, t2;
+        asm volatile(
+            "1:\n\t"
+            "xor %k[t0], %k[t0]\n\t"
+            "mulx (%[a]), %[t0], %[t1]\n\t"
+            "adcx %[carry], %[t0]\n\t"
+            "mov %[t0], (%[r])\n\t"
+            "mulx 8(%[a]), %[t0], %[t2]\n\t"
+            "adcx %[t1], %[t0]\n\t"
+            "mov %[t0], 8(%[r])\n\t"
+            "mulx 16(%[a]), %[t0], %[t1]\n\t"
+            "adcx %[t2], %[t0]\n\t"
+            "mov %[t0], 16(%[r])\n\t"
+            "mulx 24(%[a]), %[t0], %[t2]\n\t"
+            "adcx %[t1], %[t0]\n\t"
+            "mov %[t0], 24(%[r])\n\t"
+            "mov $0, %k[t0]\n\t"
+            "adcx %[t0], %[t2]\n\t"
+            "mov %[t2], %[carry]\n\t"
+            "lea 32(%[a]), %[a]\n\t"
+            "lea 32(%[r]), %[r]\n\t"
+            "dec %[blocks]\n\t"
+            "jnz 1b\n\t"
+            : [r] "+r"(rp), [a] "+r"(ap), [blocks] "+r"(blocks), [carry] "+r"(carry),
+              [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2)
+            : "d"(b)
+            : "cc", "memory");
+    }
+
+    for (int i = n / 4 * 4; i < n; i++) {
+        const __uint128_t c = static_cast<__uint128_t>(a[i]) * b + carry;
+        r[i] = static_cast<uint64_t>(c);
+        carry = static_cast<uint64_t>(c >> 64);
+    }
+    return carry;
+}
+
+uint64_t big_int_impl::limbs_addmul_1_adx(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+    uint64_t carry = 0;
+    if (long blocks = n / 4; blocks > 0) {
+        uint64_t* rp = r;
+        const uint64_t* ap = a;
+        uint64_t t0, t1, t2;
+        asm volatile(
+            "1:\n\t"
+            "xor %k[t0], %k[t0]\n\t"
+            "mulx (%[a]), %[t0], %[t1]\n\t"
+            "adcx %[carry], %[t0]\n\t"
+            "adox (%[r]), %[t0]\n\t"
+            "mov %[t0], (%[r])\n\t"
+            "mulx 8(%[a]), %[t0], %[t2]\n\t"
+            "adcx %[t1], %[t0]\n\t"
+            "adox 8(%[r]), %[t0]\n\t"
+            "mov %[t0], 8(%[r])\n\t"
+            "mulx 16(%[a]), %[t0], %[t1]\n\t"
+            "adcx %[t2], %[t0]\n\t"
+            "adox 16(%[r]), %[t0]\n\t"
+            "mov %[t0], 16(%[r])\n\t"
+            "mulx 24(%[a]), %[t0], %[t2]\n\t"
+            "adcx %[t1], %[t0]\n\t"
+            "adox 24(%[r]), %[t0]\n\t"
+            "mov %[t0], 24(%[r])\n\t"
+            "mov $0, %k[t0]\n\t"
+            "adcx %[t0], %[t2]\n\t"
+            "adox %[t0], %[t2]\n\t"
+            "mov %[t2], %[carry]\n\t"
+            "lea 32(%[a]), %[a]\n\t"
+            "lea 32(%[r]), %[r]\n\t"
+            "dec %[blocks]\n\t"
+            "jnz 1b\n\t"
+            : [r] "+r"(rp), [a] "+r"(ap), [blocks] "+r"(blocks), [carry] "+r"(carry),
+              [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2)
+            : "d"(b)
+            : "cc", "memory");
+    }
+
+    for (int i = n / 4 * 4; i < n; i++) {
+        const __uint128_t c = static_cast<__uint128_t>(a[i]) * b + r[i] + carry;
+        r[i] = static_cast<uint64_t>(c);
+        carry = static_cast<uint64_t>(c >> 64);
+    }
+    return carry;
+}
+
+/**
+ * Subtraction goes through the OF chain as `r + ~p + 1`: OF is set to 1 in the beginning of a block
+ * and OF = 1 in its end means that there was no borrow.
+ */
+uint64_t big_int_impl::limbs_submul_1_adx(uint64_t* r, const uint64_t* a, const int n, const uint64_t b) {
+    uint64_t borrow = 0;
+    if (long blocks = n / 4; blocks > 0) {
+        uint64_t* rp = r;
+        const uint64_t* ap = a;
+        uint64_t t0, t1, t2;
+        asm volatile(
+            "1:\n\t"
+            "movabs $0x7fffffffffffffff, %[t0]\n\t"
+            "add $1, %[t0]\n\t"
+            "mulx (%[a]), %[t0], %[t1]\n\t"
+            "adcx %[borrow], %[t0]\n\t"
+            "not %[t0]\n\t"
+            "adox (%[r]), %[t0]\n\t"
+            "mov %[t0], (%[r])\n\t"
+            "mulx 8(%[a]), %[t0], %[t2]\n\t"
+            "adcx %[t1], %[t0]\n\t"
+            "not %[t0]\n\t"
+            "adox 8(%[r]), %[t0]\n\t"
+            "mov %[t0], 8(%[r])\n\t"
+            "mulx 16(%[a]), %[t0], %[t1]\n\t"
+            "adcx %[t2], %[t0]\n\t"
+            "not %[t0]\n\t"
+            "adox 16(%[r]), %[t0]\n\t"
+            "mov %[t0], 16(%[r])\n\t"
+            "mulx 24(%[a]), %[t0], %[t2]\n\t"
+            "adcx %[t1], %[t0]\n\t"
+            "not %[t0]\n\t"
+            "adox 24(%[r]), %[t0]\n\t"
+            "mov %[t0], 24(%[r])\n\t"
+            "mov $0, %k[t0]\n\t"
+            "adcx %[t0], %[t2]\n\t"
+            "lea 1(%[t2]), %[t1]\n\t"
+            "cmovo %[t2], %[t1]\n\t"
+            "mov %[t1], %[borrow]\n\t"
+            "lea 32(%[a]), %[a]\n\t"
+            "lea 32(%[r]), %[r]\n\t"
+            "dec %[blocks]\n\t"
+            "jnz 1b\n\t"
+            : [r] "+r"(rp), [a] "+r"(ap), [blocks] "+r"(blocks), [borrow] "+r"(borrow),
+              [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2)
+            : "d"(b)
+            : "cc", "memory");
+    }
+
+    for (int i = n / 4 * 4; i < n; i++) {
+        const __uint128_t product = static_cast<__uint128_t>(a[i]) * b + borrow;
+        const uint64_t low = static_cast<uint64_t>(product);
+        borrow = static_cast<uint64_t>(product >> 64) + (r[i] < low);
+        r[i] -= low;
+    }
+    return borrow;
+}
+
+#endif
@@ -0,0 +1,192 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/newton_division.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/limbs.h>
+#include <big_int/ntt.h>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace {
+    /**
+     * `|a| >> (64 * limbs)`
+     */
+    bint_t high_limbs(const bint_t& a, const int limbs) {
+        if (limbs >= static_cast<int>(a.data.size()))
+            return bint_t(0);
+
+        bint_t result;
+        result.data.assign(a.data.begin() + limbs, a.data.end());
+        big_int_impl::normalize(result);
+        return result;
+    }
+
+    /**
+     * `2^(64 n)`
+     */
+    bint_t power_of_base(const int n) {
+        bint_t result;
+        result.data.resize(n + 1);
+        result.data[n] = 1;
+        return result;
+    }
+
+    /**
+     * `a mod (2^(64 n) - 1)`, the result can be equal to the modulus
+     */
+    bint_t fold_wrapped(const bint_t& a, const int n) {
+        bint_t result;
+        result.data.resize(n);
+        uint64_t carry = 0;
+        for (int start = 0; start < a.data.size(); start += n) {
+            const int size = std::min<int>(n, a.data.size() - start);
+            carry += big_int_impl::limbs_add_inplace(result.data.data(), n, a.data.data() + start, size);
+        }
+        while (carry > 0) {
+            carry = big_int_impl::limbs_add_inplace(result.data.data(), n, &carry, 1);
+        }
+        big_int_impl::normalize(result);
+        return result;
+    }
+
+    /**
+     * `c - a * b` for non-negative operands, when it is known that `|c - a * b| < 2^(64 size - 1)`.
+     * High limbs of the product cancel with `c`, so for NTT-sized operands the product is computed
+     * modulo `2^(64 n) - 1` with `n >= size`, which takes a transform of about half the size.
+     */
+    bint_t small_difference(const bint_t& c, const bint_t& a, const bint_t& b, const int size) {
+        const int a_size = a.data.size();
+        const int b_size = b.data.size();
+        const int n = std::bit_ceil(static_cast<unsigned>(size));
+        if (std::min(a_size, b_size) < big_int::get_thresholds().ntt || std::max(a_size, b_size) > n ||
+            n >= std::bit_ceil(static_cast<unsigned>(a_size + b_size - 1))) {
+            return c - a * b;
+        }
+
+        bint_t result = fold_wrapped(c, n);
+        result -= ntt_multiply_wrapped(a, b, n);
+
+        // `result` is congruent to the answer modulo 2^(64 n) - 1, the answer is the one that is small
+        if (big_int_impl::count_bits(result) >= 64ll * size) {
+            bint_t modulus;
+            modulus.data.assign(n, ~0ull);
+            if (result.sign) {
+                result += modulus;
+            } else {
+                result -= modulus;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Divides `a < 2^(64 n) * b` by the normalized `n`-limb `b` with the reciprocal `x = newton_reciprocal(b)`.
+     * The quotient estimate is off by a few units and is fixed by the correction steps.
+     */
+    void divide_block_with_reciprocal(const bint_t& a, const bint_t& b, const bint_t& x, bint_t& quotient, bint_t& rem) {
+        const int n = b.data.size();
+        quotient = high_limbs(high_limbs(a, n - 1) * x, n + 1);
+        // |rem| < 8 b before the correction
+        rem = small_difference(a, quotient, b, n + 2);
+        while (rem.sign) {
+            rem += b;
+            quotient -= bint_t(1);
+        }
+        while (big_int_impl::compare_abs(rem, b) >= 0) {
+            rem -= b;
+            quotient += bint_t(1);
+        }
+    }
+}
+
+bint_t newton_reciprocal(const bint_t& b) { // NOLINT(*-no-recursion)
+    const int n = b.data.size();
+    if (b.data.back() >> 63 == 0) throw std::runtime_error("newton_reciprocal: b is not normalized");
+
+    if (n < big_int::get_thresholds().newton_division) {
+        bint_t x = power_of_base(2 * n);
+        bint_t rem;
+        big_int::divide_abs(x, b, rem, big_int::division_output::quotient);
+        return x;
+    }
+
+    // The relative error of the reciprocal of the highest `h` limbs is about 2^(-64 (h - 1)),
+    // `2 h >= n + 3` makes the error of the Newton step below one unit
+    const int h = (n + 4) / 2;
+    const int low = n - h;
+    const bint_t x_h = newton_reciprocal(high_limbs(b, low));
+
+    // x_0 = x_h * 2^(64 low), its residual is 2^(128 n) - b * x_0 = e * 2^(64 low)
+    // |e| < 2^(64 (n + 2)) by the error bound of `x_h`
+    const bint_t e = small_difference(power_of_base(n + h), b, x_h, n + 3);
+
+    // x = x_0 + x_0 * e * 2^(64 low) / 2^(128 n) = x_0 + x_h * e / 2^(128 h), lowest limbs of `e` don't affect the result
+    const bint_t delta = high_limbs(x_h * high_limbs(e, h - 1), h + 1);
+    bint_t x = x_h << 64 * low;
+    if (e.sign) {
+        x -= delta;
+    } else {
+        x += delta;
+    }
+    return x;
+}
+
+void divide_with_reciprocal(bint_t& a, const bint_t& b, const bint_t& x, bint_t& rem, const big_int::division_output output) {
+    const int n = b.data.size();
+    const int m = a.data.size();
+    if (m < n) {
+        rem = std::move(a);
+        a = bint_t(0);
+        return;
+    }
+
+    // Long division in base 2^(64 n): the remainder of every step is prepended to the next block of `a`
+    const int blocks = (m + n - 1) / n;
+    const bool need_quotient = output != big_int::division_output::remainder;
+    bint_t quotient;
+    if (need_quotient) quotient.data.resize(blocks * n);
+    bint_t current = high_limbs(a, (blocks - 1) * n);
+    bint_t block_quotient;
+    for (int i = blocks - 1; i >= 0; i--) {
+        if (i < blocks - 1) {
+            current.data.resize(n + rem.data.size());
+            std::copy(a.data.begin() + i * n, a.data.begin() + (i + 1) * n, current.data.begin());
+            std::copy(rem.data.begin(), rem.data.end(), current.data.begin() + n);
+            big_int_impl::normalize(current);
+        }
+        divide_block_with_reciprocal(current, b, x, block_quotient, rem);
+        if (block_quotient.data.size() > n) throw std::runtime_error("divide_with_reciprocal: block quotient is too large");
+        if (need_quotient) {
+            std::copy(block_quotient.data.begin(), block_quotient.data.end(), quotient.data.begin() + i * n);
+        }
+    }
+
+    if (!need_quotient) {
+        a = bint_t(0);
+        return;
+    }
+    a = std::move(quotient);
+    big_int_impl::normalize(a);
+}
+
+void divide_newton(bint_t& a, const bint_t& b, bint_t& rem, const big_int::division_output output) {
+    if (big_int_impl::compare_abs(a, b) < 0) {
+        rem = std::move(a);
+        a = bint_t(0);
+        return;
+    }
+
+    // Shift both operands, so that the highest bit of the divisor is set
+    const int sigma = std::countl_zero(b.data.back());
+    bint_t new_b = b << sigma;
+    new_b.sign = false;
+    a.sign = false;
+    a <<= sigma;
+
+    divide_with_reciprocal(a, new_b, newton_reciprocal(new_b), rem, output);
+    if (output != big_int::division_output::quotient) rem >>= sigma;
+}
@@ -0,0 +1,292 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include "big_int/ntt.h"
+#include "big_int/big_int_ops.h"
+#include "big_int/limbs.h"
+#include "big_int/thread_pool.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <vector>
+
+using namespace big_int_impl;
+
+/**
+ * Arithmetic modulo an NTT-friendly prime `p = c * 2^k + 1 < 2^62` in the Montgomery form with R = 2^64.
+ * Values are kept in the range [0, p), twiddle factors are stored in the Montgomery form,
+ * so `mul(x, w)` returns `x * w mod p` for a regular `x`.
+ */
+struct ntt_prime {
+    uint64_t p;
+    uint64_t g;         // primitive root modulo p
+    uint64_t p_inv;     // -p^(-1) mod 2^64
+    uint64_t r2;        // R^2 mod p
+
+    constexpr ntt_prime(const uint64_t p, const uint64_t g) : p(p), g(g), p_inv(0), r2(0) {
+        uint64_t inv = p;
+        for (int i = 0; i < 5; i++) inv *= 2 - p * inv;
+        p_inv = -inv;
+        const __uint128_t r = (static_cast<__uint128_t>(1) << 64) % p;
+        r2 = static_cast<uint64_t>(r * r % p);
+    }
+
+    [[nodiscard]] uint64_t add(const uint64_t a, const uint64_t b) const {
+        const uint64_t c = a + b;
+        return c >= p ? c - p : c;
+    }
+
+    [[nodiscard]] uint64_t sub(const uint64_t a, const uint64_t b) const {
+        return a >= b ? a - b : a + p - b;
+    }
+
+    /**
+     * Montgomery reduction of `a * b`, returns `a * b * R^(-1) mod p`
+     */
+    [[nodiscard]] uint64_t mul(const uint64_t a, const uint64_t b) const {
+        const __uint128_t t = static_cast<__uint128_t>(a) * b;
+        const uint64_t m = static_cast<uint64_t>(t) * p_inv;
+        const auto u = static_cast<uint64_t>((t + static_cast<__uint128_t>(m) * p) >> 64);
+        return u >= p ? u - p : u;
+    }
+
+    [[nodiscard]] uint64_t to_montgomery(const uint64_t a) const {
+        return mul(a, r2);
+    }
+
+    [[nodiscard]] uint64_t pow(const uint64_t a, uint64_t n) const {
+        uint64_t base = to_montgomery(a);
+        uint64_t result = to_montgomery(1);
+        while (n > 0) {
+            if (n & 1) result = mul(result, base);
+            base = mul(base, base);
+            n >>= 1;
+        }
+        return mul(result, 1); // back from the Montgomery form
+    }
+};
+
+// All three primes have the form c * 2^42 + 1, so transforms up to 2^42 elements are supported.
+// p1 * p2 * p3 > 2^185, which is enough to restore any coefficient of the convolution
+// of 64-bit limbs (< n * 2^128) exactly
+constexpr ntt_prime ntt_primes[3] = {
+    ntt_prime(4611615649683210241ull, 11),
+    ntt_prime(4611549678985543681ull, 19),
+    ntt_prime(4611496902427410433ull, 5),
+};
+constexpr int NTT_MAX_LOG_SIZE = 42;
+
+/**
+ * Computes tables of roots for all levels of the transform of size `n`: `roots[len / 2 + j] = w_len^j`,
+ * where `w_len` is a primitive root of unity of degree `len`. Roots are stored in the Montgomery form.
+ */
+std::vector<uint64_t> ntt_roots(const ntt_prime& prime, const int n, const bool inverse) {
+    std::vector<uint64_t> roots(std::max(n, 2));
+    for (int half = 1; half < n; half <<= 1) {
+        uint64_t w = prime.pow(prime.g, (prime.p - 1) / (2 * half));
+        if (inverse) w = prime.pow(w, prime.p - 2);
+        const uint64_t w_mont = prime.to_montgomery(w);
+        uint64_t current = prime.to_montgomery(1);
+        for (int j = 0; j < half; j++) {
+            roots[half + j] = current;
+            current = prime.mul(current, w_mont);
+        }
+    }
+    return roots;
+}
+
+/**
+ * Decimation-in-frequency transform: natural order in, bit-reversed order out
+ */
+void ntt_forward(const ntt_prime& prime, std::vector<uint64_t>& a, const std::vector<uint64_t>& roots) {
+    const int n = a.size();
+    for (int half = n / 2; half >= 1; half >>= 1) {
+        const uint64_t* w = roots.data() + half;
+        for (int i = 0; i < n; i += 2 * half) {
+            uint64_t* x = a.data() + i;
+            uint64_t* y = x + half;
+            for (int j = 0; j < half; j++) {
+                const uint64_t u = x[j];
+                const uint64_t v = y[j];
+                x[j] = prime.add(u, v);
+                y[j] = prime.mul(prime.sub(u, v), w[j]);
+            }
+        }
+    }
+}
+
+/**
+ * Decimation-in-time transform: bit-reversed order in, natural order out. Result is not divided by `n`.
+ */
+void ntt_inverse(const ntt_prime& prime, std::vector<uint64_t>& a, const std::vector<uint64_t>& roots) {
+    const int n = a.size();
+    for (int half = 1; half < n; half <<= 1) {
+        const uint64_t* w = roots.data() + half;
+        for (int i = 0; i < n; i += 2 * half) {
+            uint64_t* x = a.data() + i;
+            uint64_t* y = x + half;
+            for (int j = 0; j < half; j++) {
+                const uint64_t u = x[j];
+                const uint64_t v = prime.mul(y[j], w[j]);
+                x[j] = prime.add(u, v);
+                y[j] = prime.sub(u, v);
+            }
+        }
+    }
+}
+
+void ntt_load(const ntt_prime& prime, std::vector<uint64_t>& dst, const bint_t& a, const int a_limit) {
+    for (int i = 0; i < a_limit; i++) {
+        dst[i] = a.data[i] % prime.p;
+    }
+    std::fill(dst.begin() + a_limit, dst.end(), 0);
+}
+
+/**
+ * Computes the cyclic convolution of `a` and `b` (or `a` with itself if `b == nullptr`) modulo `prime`.
+ * The result of size `n` is stored in `dst`.
+ */
+void ntt_convolution(const ntt_prime& prime, std::vector<uint64_t>& dst, const int n,
+                     const bint_t& a, const int a_limit, const bint_t* b, const int b_limit) {
+    const auto roots = ntt_roots(prime, n, false);
+    dst.resize(n);
+    ntt_load(prime, dst, a, a_limit);
+    ntt_forward(prime, dst, roots);
+
+    if (b == nullptr) {
+        for (int i = 0; i < n; i++) dst[i] = prime.mul(dst[i], dst[i]);
+    } else {
+        std::vector<uint64_t> other(n);
+        ntt_load(prime, other, *b, b_limit);
+        ntt_forward(prime, other, roots);
+        for (int i = 0; i < n; i++) dst[i] = prime.mul(dst[i], other[i]);
+    }
+
+    ntt_inverse(prime, dst, ntt_roots(prime, n, true));
+
+    // Pointwise products are multiplied by R^(-1), inverse transform is multiplied by n,
+    // so scale everything by n^(-1) * R with a single Montgomery multiplication by n^(-1) * R^2
+    const uint64_t scale = prime.mul(prime.to_montgomery(prime.pow(n, prime.p - 2)), prime.r2);
+    for (int i = 0; i < n; i++) dst[i] = prime.mul(dst[i], scale);
+}
+
+/**
+ * Restores coefficients of the convolution from residues with Garner's algorithm
+ * and propagates carries into the limbs of `result`
+ */
+void ntt_crt_recombine(bint_t& result, const std::vector<uint64_t> (&residues)[3], const int size) {
+    const ntt_prime& p1 = ntt_primes[0];
+    const ntt_prime& p2 = ntt_primes[1];
+    const ntt_prime& p3 = ntt_primes[2];
+
+    // Constants in the Montgomery form for the multiplication with `ntt_prime::mul`
+    const uint64_t p1_inv_mod_p2 = p2.to_montgomery(p2.pow(p1.p % p2.p, p2.p - 2));
+    const uint64_t p1_mod_p3 = p3.to_montgomery(p1.p % p3.p);
+    const uint64_t p12_inv_mod_p3 = p3.to_montgomery(p3.pow(static_cast<uint64_t>(
+        static_cast<__uint128_t>(p1.p) * p2.p % p3.p), p3.p - 2));
+    const __uint128_t p12 = static_cast<__uint128_t>(p1.p) * p2.p;
+    const auto p12_low = static_cast<uint64_t>(p12);
+    const auto p12_high = static_cast<uint64_t>(p12 >> 64);
+
+    __uint128_t carry = 0;
+    for (int i = 0; i < size; i++) {
+        // x = v1 + v2 * p1 + v3 * p1 * p2
+        const uint64_t v1 = residues[0][i];
+        const uint64_t v2 = p2.mul(p2.sub(residues[1][i], v1 % p2.p), p1_inv_mod_p2);
+        const uint64_t t = p3.sub(p3.sub(residues[2][i], v1 % p3.p), p3.mul(v2 % p3.p, p1_mod_p3));
+        const uint64_t v3 = p3.mul(t, p12_inv_mod_p3);
+
+        const __uint128_t low = static_cast<__uint128_t>(v3) * p12_low;
+        const __uint128_t high = static_cast<__uint128_t>(v3) * p12_high + static_cast<uint64_t>(low >> 64);
+        const __uint128_t small = static_cast<__uint128_t>(v2) * p1.p + v1;
+
+        // [x0, x1, x2] = [low, high] + small + carry
+        __uint128_t s = static_cast<__uint128_t>(static_cast<uint64_t>(low)) + static_cast<uint64_t>(small)
+            + static_cast<uint64_t>(carry);
+        const auto x0 = static_cast<uint64_t>(s);
+        s = (s >> 64) + static_cast<uint64_t>(high) + static_cast<uint64_t>(small >> 64)
+            + static_cast<uint64_t>(carry >> 64);
+        const auto x1 = static_cast<uint64_t>(s);
+        const uint64_t x2 = static_cast<uint64_t>(s >> 64) + static_cast<uint64_t>(high >> 64);
+
+        result.data[i] = x0;
+        carry = static_cast<__uint128_t>(x2) << 64 | x1;
+    }
+    for (int i = size; i < result.data.size() && carry > 0; i++) {
+        result.data[i] = static_cast<uint64_t>(carry);
+        carry >>= 64;
+    }
+}
+
+/**
+ * Computes residues of the cyclic convolution of size `n` modulo all three primes
+ */
+void ntt_convolutions(std::vector<uint64_t> (&residues)[3], const int n,
+                      const bint_t& a, const int a_limit, const bint_t* b, const int b_limit) {
+    if (std::countr_zero(static_cast<uint64_t>(n)) > NTT_MAX_LOG_SIZE)
+        throw std::runtime_error("ntt_convolutions: operands are too big, n = " + std::to_string(n));
+
+    const auto convolution = [&](const int k) {
+        ntt_convolution(ntt_primes[k], residues[k], n, a, a_limit, b, b_limit);
+    };
+    if (thread_pool* pool = parallel_pool(std::max(a_limit, b_limit))) {
+        // Convolutions modulo different primes are independent
+        parallel_invoke(*pool, [&] { convolution(0); }, [&] { convolution(1); }, [&] { convolution(2); });
+    } else {
+        for (int k = 0; k < 3; k++) convolution(k);
+    }
+}
+
+bint_t ntt_multiply_abs(const bint_t& a, const int a_limit, const bint_t* b, const int b_limit) {
+    const int size = a_limit + b_limit - 1;
+    const int n = static_cast<int>(std::bit_ceil(static_cast<uint64_t>(size)));
+    std::vector<uint64_t> residues[3];
+    ntt_convolutions(residues, n, a, a_limit, b, b_limit);
+
+    bint_t result;
+    result.data.resize(a_limit + b_limit);
+    ntt_crt_recombine(result, residues, size);
+    return result;
+}
+
+bint_t ntt_multiply(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
+
+    auto result = ntt_multiply_abs(a, a_limit, &b, b_limit);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
+}
+
+void ntt_square(bint_t& a, int a_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+
+    a = ntt_multiply_abs(a, a_limit, nullptr, a_limit);
+    normalize(a);
+}
+
+bint_t ntt_multiply_wrapped(const bint_t& a, const bint_t& b, const int n) {
+    if (!std::has_single_bit(static_cast<unsigned>(n)) || a.data.size() > n || b.data.size() > n)
+        throw std::runtime_error("ntt_multiply_wrapped: invalid size " + std::to_string(n));
+
+    std::vector<uint64_t> residues[3];
+    ntt_convolutions(residues, n, a, a.data.size(), &b, b.data.size());
+
+    // Coefficients are less than 2^185, so the carry out of the last one takes three limbs
+    bint_t result;
+    result.data.resize(n + 3);
+    ntt_crt_recombine(result, residues, n);
+
+    // 2^(64 n) = 1 modulo 2^(64 n) - 1: add the carry to the lowest limbs
+    uint64_t* r = result.data.data();
+    uint64_t carry = limbs_add_inplace(r, n, r + n, 3);
+    while (carry > 0) {
+        carry = limbs_add_inplace(r, n, &carry, 1);
+    }
+    result.data.resize(n);
+    normalize(result);
+    return result;
+}
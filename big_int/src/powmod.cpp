@@ -0,0 +1,239 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/big_int_ops.h>
+#include <big_int/bint_divisor.h>
+#include <big_int/limbs.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /**
+     * Multiplication modulo an odd `n`-limb `m` in the Montgomery form `a R mod m`, `R = 2^(64 n)`.
+     * Elements are `bint_t` with exactly `n` limbs, products are computed with the allocation-free schoolbook,
+     * Karatsuba and Toom-3 kernels and reduced with REDC, so no division is needed.
+     */
+    class montgomery_context {
+    public:
+        explicit montgomery_context(const bint_t& m) : m(m), n(m.data.size()), m_inverse(-big_int_impl::limb_inverse(m.data[0])) {
+            product.resize(2 * n + 1);
+            const int scratch_size = std::max(big_int_impl::limbs_mul_scratch_size(n), big_int_impl::limbs_square_scratch_size(n));
+            scratch.resize(scratch_size);
+
+            // Large moduli reduce with two multiplications instead of the quadratic word-by-word loop,
+            // it pays off when the multiplication is Toom-3
+            if (n >= big_int::get_thresholds().toom_cook) {
+                full_inverse = negated_inverse();
+                low_product.resize(2 * n);
+                u.resize(n);
+            }
+        }
+
+        [[nodiscard]] bint_t to_form(const bint_t& a) const {
+            bint_t result = a << 64 * n;
+            bint_t rem;
+            big_int::divide_abs(result, m, rem, big_int::division_output::remainder);
+            rem.data.resize(n);
+            return rem;
+        }
+
+        [[nodiscard]] bint_t from_form(const bint_t& a) {
+            std::fill(product.begin(), product.end(), 0);
+            std::copy(a.data.begin(), a.data.end(), product.begin());
+            bint_t result;
+            result.data.resize(n);
+            reduce(result.data.data());
+            big_int_impl::normalize(result);
+            return result;
+        }
+
+        [[nodiscard]] bint_t one() const {
+            return to_form(bint_t(1));
+        }
+
+        void multiply(bint_t& a, const bint_t& b) {
+            big_int_impl::limbs_mul_n(product.data(), a.data.data(), b.data.data(), n, scratch.data());
+            product[2 * n] = 0;
+            reduce(a.data.data());
+        }
+
+        void square(bint_t& a) {
+            big_int_impl::limbs_square_n(product.data(), a.data.data(), n, scratch.data());
+            product[2 * n] = 0;
+            reduce(a.data.data());
+        }
+
+    private:
+        const bint_t& m;
+        const int n;
+        const uint64_t m_inverse;
+        // `-m^(-1) mod R`, only for the reduction with multiplications
+        std::vector<uint64_t> full_inverse;
+        std::vector<uint64_t> product;
+        std::vector<uint64_t> low_product;
+        std::vector<uint64_t> u;
+        std::vector<uint64_t> scratch;
+
+        /**
+         * Digits `u` of `-m^(-1) mod R`, chosen one by one so that `1 + m u` is divisible by `R`
+         */
+        [[nodiscard]] std::vector<uint64_t> negated_inverse() const {
+            std::vector<uint64_t> u(n), acc(n);
+            acc[0] = 1;
+            for (int i = 0; i < n; i++) {
+                u[i] = acc[i] * m_inverse;
+                big_int_impl::limbs_addmul_1(acc.data() + i, m.data.data(), n - i, u[i]);
+            }
+            return u;
+        }
+
+        /**
+         * `r = product / R mod m` for `product < m R`
+         */
+        void reduce(uint64_t* r) {
+            const uint64_t* m_data = m.data.data();
+            if (full_inverse.empty()) {
+                // Adding `u m 2^(64 i)` clears the `i`-th limb of the product
+                for (int i = 0; i < n; i++) {
+                    const uint64_t u = product[i] * m_inverse;
+                    uint64_t carry = big_int_impl::limbs_addmul_1(product.data() + i, m_data, n, u);
+                    big_int_impl::limbs_add_inplace(product.data() + i + n, n + 1 - i, &carry, 1);
+                }
+            } else {
+                // u = product * (-m^(-1)) mod R, then product + u m is divisible by R
+                big_int_impl::limbs_mul_n(low_product.data(), product.data(), full_inverse.data(), n, scratch.data());
+                std::copy_n(low_product.data(), n, u.data());
+                big_int_impl::limbs_mul_n(low_product.data(), u.data(), m_data, n, scratch.data());
+                big_int_impl::limbs_add_inplace(product.data(), 2 * n + 1, low_product.data(), 2 * n);
+            }
+
+            // The result is less than 2 m
+            uint64_t* high = product.data() + n;
+            if (high[n] != 0 || big_int_impl::limbs_compare(high, n, m_data, n) >= 0) {
+                big_int_impl::limbs_sub(high, high, n, m_data, n);
+            }
+            std::copy_n(high, n, r);
+        }
+    };
+
+    /**
+     * Multiplication modulo any `m` with the reduction by the precomputed `bint_divisor`
+     */
+    class barrett_context {
+    public:
+        explicit barrett_context(const bint_t& m) : divisor(m) {}
+
+        [[nodiscard]] bint_t to_form(const bint_t& a) const { return a; }
+        [[nodiscard]] bint_t from_form(const bint_t& a) const { return a; }
+        [[nodiscard]] bint_t one() const { return bint_t(1); }
+
+        void multiply(bint_t& a, const bint_t& b) {
+            a *= b;
+            reduce(a);
+        }
+
+        void square(bint_t& a) {
+            big_int_impl::square(a);
+            reduce(a);
+        }
+
+    private:
+        bint_divisor divisor;
+        bint_t rem;
+
+        void reduce(bint_t& a) {
+            divisor.divide_abs(a, rem, big_int::division_output::remainder);
+            std::swap(a, rem);
+        }
+    };
+
+    bool exponent_bit(const bint_t& exp, const uint64_t i) {
+        return exp.data[i / 64] >> i % 64 & 1;
+    }
+
+    /**
+     * Width of the window for the exponent with `bits` bits: the table of `2^(k - 1)` odd powers
+     * is paid off by `bits / (k + 1)` multiplications instead of `bits / 2`
+     */
+    int window_size(const uint64_t bits) {
+        if (bits <= 8) return 1;
+        if (bits <= 24) return 2;
+        if (bits <= 80) return 3;
+        if (bits <= 240) return 4;
+        if (bits <= 672) return 5;
+        return 6;
+    }
+
+    /**
+     * `base^exp` with the sliding window scanning of the exponent from the highest bit, `exp > 0`.
+     * Every window is a run of at most `k` bits that starts and ends with one, it is applied with a single
+     * multiplication by a precomputed odd power of `base`.
+     */
+    template<typename Context>
+    bint_t sliding_window_pow(Context& context, const bint_t& base, const bint_t& exp) {
+        const uint64_t bits = big_int_impl::count_bits(exp);
+        const int k = window_size(bits);
+
+        // odd_powers[i] = base^(2 i + 1)
+        std::vector<bint_t> odd_powers(1 << (k - 1));
+        odd_powers[0] = context.to_form(base);
+        if (k > 1) {
+            bint_t base_squared = odd_powers[0];
+            context.square(base_squared);
+            for (int i = 1; i < odd_powers.size(); i++) {
+                odd_powers[i] = odd_powers[i - 1];
+                context.multiply(odd_powers[i], base_squared);
+            }
+        }
+
+        bint_t result;
+        bool started = false;
+        for (int64_t i = static_cast<int64_t>(bits) - 1; i >= 0;) {
+            if (!exponent_bit(exp, i)) {
+                context.square(result);
+                i--;
+                continue;
+            }
+
+            int64_t low = std::max<int64_t>(i - k + 1, 0);
+            while (!exponent_bit(exp, low)) low++;
+            uint64_t window = 0;
+            for (int64_t j = i; j >= low; j--) {
+                window = window << 1 | exponent_bit(exp, j);
+            }
+
+            if (started) {
+                for (int64_t j = i; j >= low; j--) {
+                    context.square(result);
+                }
+                context.multiply(result, odd_powers[window / 2]);
+            } else {
+                result = odd_powers[window / 2];
+                started = true;
+            }
+            i = low - 1;
+        }
+        return context.from_form(result);
+    }
+}
+
+bint_t big_int::powmod(const bint_t& base, const bint_t& exp, const bint_t& mod) {
+    if (mod.sign || (mod.data.size() == 1 && mod.data[0] == 0))
+        throw std::invalid_argument("powmod: mod must be positive");
+    if (exp.sign)
+        throw std::invalid_argument("powmod: exp must be non-negative");
+
+    bint_t reduced_base = base % mod;
+    if (mod.data.size() == 1 && mod.data[0] == 1) return bint_t(0);
+    if (exp.data.size() == 1 && exp.data[0] == 0) return bint_t(1);
+
+    if (mod.data[0] % 2 == 1) {
+        montgomery_context context(mod);
+        return sliding_window_pow(context, reduced_base, exp);
+    }
+    barrett_context context(mod);
+    return sliding_window_pow(context, reduced_base, exp);
+}
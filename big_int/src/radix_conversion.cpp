@@ -0,0 +1,149 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/radix_conversion.h>
+#include <big_int/big_int_ops.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+static_assert(std::endian::native == std::endian::little, "digits of a limb are reordered with a byte swap");
+
+namespace {
+    constexpr uint64_t bytes(const uint8_t value) {
+        return 0x0101010101010101ull * value;
+    }
+
+    /**
+     * Moves the nibble `i` of `x` to the low half of the byte `i`
+     */
+    uint64_t spread_nibbles(const uint32_t x) {
+        uint64_t v = x;
+        v = (v | v << 16) & 0x0000FFFF0000FFFFull;
+        v = (v | v << 8) & 0x00FF00FF00FF00FFull;
+        v = (v | v << 4) & bytes(0x0F);
+        return v;
+    }
+
+    /**
+     * Inverse of `spread_nibbles`
+     */
+    uint32_t pack_nibbles(uint64_t v) {
+        v = (v | v >> 4) & 0x00FF00FF00FF00FFull;
+        v = (v | v >> 8) & 0x0000FFFF0000FFFFull;
+        v = (v | v >> 16) & 0x00000000FFFFFFFFull;
+        return static_cast<uint32_t>(v);
+    }
+
+    /**
+     * Hexadecimal digits of the nibbles in every byte: `'0' + x`, plus the gap between `'9'` and `'a'` for `x > 9`
+     */
+    uint64_t hex_chars(const uint64_t nibbles) {
+        const uint64_t letters = ((nibbles + bytes(6)) >> 4) & bytes(1);
+        return nibbles + bytes('0') + letters * ('a' - '0' - 10);
+    }
+
+    /**
+     * Values of hexadecimal digits in every byte: the low nibble of the character, plus 9 for letters in any case
+     */
+    uint64_t hex_values(const uint64_t chars) {
+        const uint64_t letters = (chars >> 6) & bytes(1);
+        return (chars & bytes(0x0F)) + letters * 9;
+    }
+
+    /**
+     * Writes 16 hexadecimal digits of `limb`, the highest one first
+     */
+    void write_hex_limb(char* buffer, const uint64_t limb) {
+        const uint64_t high = __builtin_bswap64(hex_chars(spread_nibbles(limb >> 32)));
+        const uint64_t low = __builtin_bswap64(hex_chars(spread_nibbles(static_cast<uint32_t>(limb))));
+        std::memcpy(buffer, &high, 8);
+        std::memcpy(buffer + 8, &low, 8);
+    }
+
+    /**
+     * ASCII digits of `value < 10^8` in 8 bytes, the highest digit in the lowest byte. Every step splits all lanes
+     * of the word at once by a multiplication and a shift: halves of 4 digits in 32-bit lanes, then pairs of digits
+     * in 16-bit lanes, then digits in bytes. `x * 10486 >> 20 = x / 100` for `x < 10^4`, `x * 103 >> 10 = x / 10`
+     * for `x < 100`, and the products don't overflow into the next lane.
+     */
+    uint64_t decimal_chars_8(const uint32_t value) {
+        uint64_t v = value / 10000 | static_cast<uint64_t>(value % 10000) << 32;
+        const uint64_t hundreds = (v * 10486 >> 20) & 0x0000007F0000007Full;
+        v = hundreds | (v - hundreds * 100) << 16;
+        const uint64_t tens = (v * 103 >> 10) & 0x000F000F000F000Full;
+        v = tens | (v - tens * 10) << 8;
+        return v | bytes('0');
+    }
+
+    uint64_t read_hex_limb(const char* buffer) {
+        uint64_t high, low;
+        std::memcpy(&high, buffer, 8);
+        std::memcpy(&low, buffer + 8, 8);
+        return static_cast<uint64_t>(pack_nibbles(hex_values(__builtin_bswap64(high)))) << 32
+            | pack_nibbles(hex_values(__builtin_bswap64(low)));
+    }
+}
+
+void write_decimal_group(char* buffer, const uint64_t group) {
+    constexpr uint64_t power8 = 100000000;
+    const auto high = static_cast<uint32_t>(group / (power8 * power8));
+    const uint64_t rest = group % (power8 * power8);
+    buffer[0] = static_cast<char>('0' + high / 100);
+    buffer[1] = static_cast<char>('0' + high / 10 % 10);
+    buffer[2] = static_cast<char>('0' + high % 10);
+    const uint64_t middle = decimal_chars_8(static_cast<uint32_t>(rest / power8));
+    const uint64_t low = decimal_chars_8(static_cast<uint32_t>(rest % power8));
+    std::memcpy(buffer + 3, &middle, 8);
+    std::memcpy(buffer + 11, &low, 8);
+}
+
+void power2_radix_to_string(const bint_t& a, char* buffer, const int digits, const int bits_per_digit) {
+    const uint64_t* limbs = a.data.data();
+    const int size = a.data.size();
+    const uint64_t mask = (1ull << bits_per_digit) - 1;
+
+    // Digits are counted from the lowest one, which is the last in the buffer
+    int i = 0;
+    if (bits_per_digit == 4) {
+        for (; i + 16 <= digits && i / 16 < size; i += 16) {
+            write_hex_limb(buffer + digits - i - 16, limbs[i / 16]);
+        }
+    }
+    for (; i < digits; i++) {
+        const int64_t position = static_cast<int64_t>(i) * bits_per_digit;
+        const int index = static_cast<int>(position / 64);
+        const int offset = static_cast<int>(position % 64);
+        uint64_t value = index < size ? limbs[index] >> offset : 0;
+        // Digits of the radixes 8 and 32 can cross the boundary of limbs
+        if (offset + bits_per_digit > 64 && index + 1 < size) value |= limbs[index + 1] << (64 - offset);
+        buffer[digits - 1 - i] = radix_digit_chars[value & mask];
+    }
+}
+
+bint_t power2_radix_from_digits(const char* digits, const int length, const int bits_per_digit) {
+    bint_t result;
+    result.data.resize(std::max<int64_t>(1, (static_cast<int64_t>(length) * bits_per_digit + 63) / 64));
+    uint64_t* limbs = result.data.data();
+    const int size = result.data.size();
+
+    // Digits are counted from the lowest one, which is the last in the string
+    int i = 0;
+    if (bits_per_digit == 4) {
+        for (; i + 16 <= length; i += 16) {
+            limbs[i / 16] = read_hex_limb(digits + length - i - 16);
+        }
+    }
+    for (; i < length; i++) {
+        const int64_t position = static_cast<int64_t>(i) * bits_per_digit;
+        const int index = static_cast<int>(position / 64);
+        const int offset = static_cast<int>(position % 64);
+        const uint64_t value = radix_digit_value(digits[length - 1 - i]);
+        limbs[index] |= value << offset;
+        if (offset + bits_per_digit > 64 && index + 1 < size) limbs[index + 1] |= value >> (64 - offset);
+    }
+    big_int_impl::normalize(result);
+    return result;
+}
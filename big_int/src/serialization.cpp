@@ -0,0 +1,154 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/serialization.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(std::endian::native == std::endian::little, "limbs are stored in the native byte order");
+
+namespace {
+    constexpr char binary_magic[4] = {'B', 'I', 'N', 'T'};
+
+    struct binary_header {
+        char magic[4];
+        uint16_t version;
+        uint8_t sign;
+        uint8_t reserved;
+        uint64_t size;
+    };
+    static_assert(sizeof(binary_header) == 16);
+
+    binary_header make_header(const bint_t& a) {
+        binary_header header{};
+        std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+        header.version = big_int::binary_format_version;
+        header.sign = a.sign ? 1 : 0;
+        header.size = a.data.size();
+        return header;
+    }
+
+    /**
+     * Checks everything but the limbs themselves, `limbs_available` is the number of limbs after the header
+     */
+    void check_header(const binary_header& header, const uint64_t limbs_available, const char* function) {
+        const auto fail = [&](const std::string& reason) {
+            throw std::runtime_error(std::string(function) + ": " + reason);
+        };
+        if (std::memcmp(header.magic, binary_magic, sizeof(binary_magic)) != 0) fail("not a number in the binary format");
+        if (header.version != big_int::binary_format_version) fail("unsupported version " + std::to_string(header.version));
+        if (header.sign > 1 || header.reserved != 0) fail("invalid header");
+        if (header.size == 0) fail("number has no limbs");
+        if (header.size > limbs_available) {
+            fail("truncated input, expected " + std::to_string(header.size) + " limbs, got " + std::to_string(limbs_available));
+        }
+    }
+
+    /**
+     * Checks that the limbs are normalized, so the number can be used without `normalize`
+     */
+    void check_limbs(const binary_header& header, const uint64_t* limbs, const char* function) {
+        if ((header.size > 1 && limbs[header.size - 1] == 0) || (header.size == 1 && limbs[0] == 0 && header.sign)) {
+            throw std::runtime_error(std::string(function) + ": number is not normalized");
+        }
+    }
+
+    bint_t read_binary_limited(std::istream& input, const uint64_t limbs_available, const char* function) {
+        binary_header header{};
+        if (!input.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            throw std::runtime_error(std::string(function) + ": truncated header");
+        }
+        check_header(header, limbs_available, function);
+
+        bint_t result;
+        result.sign = header.sign != 0;
+        result.data.resize(header.size);
+        const auto bytes = static_cast<std::streamsize>(header.size * sizeof(uint64_t));
+        if (!input.read(reinterpret_cast<char*>(result.data.data()), bytes)) {
+            check_header(header, input.gcount() / sizeof(uint64_t), function);
+        }
+        check_limbs(header, result.data.data(), function);
+        return result;
+    }
+}
+
+void big_int::write_binary(std::ostream& output, const bint_t& a) {
+    const binary_header header = make_header(a);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(a.data.data()), static_cast<std::streamsize>(a.data.size() * sizeof(uint64_t)));
+    if (!output) throw std::runtime_error("write_binary: write failed");
+}
+
+void big_int::save_binary(const std::string& path, const bint_t& a) {
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    if (!output) throw std::runtime_error("save_binary: cannot open " + path);
+    write_binary(output, a);
+    output.close();
+    if (!output) throw std::runtime_error("save_binary: cannot write " + path);
+}
+
+bint_t big_int::read_binary(std::istream& input) {
+    return read_binary_limited(input, UINT64_MAX, "read_binary");
+}
+
+bint_t big_int::load_binary(const std::string& path) {
+    std::ifstream input(path, std::ios::binary | std::ios::ate);
+    if (!input) throw std::runtime_error("load_binary: cannot open " + path);
+    // The size of the file is checked before the limbs are allocated
+    const uint64_t file_size = input.tellg();
+    input.seekg(0);
+    const uint64_t limbs_available =
+        (std::max<uint64_t>(file_size, sizeof(binary_header)) - sizeof(binary_header)) / sizeof(uint64_t);
+    return read_binary_limited(input, limbs_available, "load_binary");
+}
+
+// ================ bint_mapped_file ================
+
+bint_mapped_file::bint_mapped_file(const std::string& path) : mapping(nullptr), length(0) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("bint_mapped_file: cannot open " + path);
+    struct stat file_stat{};
+    if (::fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(binary_header))) {
+        ::close(fd);
+        throw std::runtime_error("bint_mapped_file: " + path + " is too short");
+    }
+    length = file_stat.st_size;
+    mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        throw std::runtime_error("bint_mapped_file: cannot map " + path);
+    }
+
+    const auto* header = static_cast<const binary_header*>(mapping);
+    const auto* limbs = reinterpret_cast<const uint64_t*>(header + 1);
+    try {
+        check_header(*header, (length - sizeof(binary_header)) / sizeof(uint64_t), "bint_mapped_file");
+        check_limbs(*header, limbs, "bint_mapped_file");
+    } catch (...) {
+        ::munmap(mapping, length);
+        throw;
+    }
+    number.sign = header->sign != 0;
+    number.data = limb_vector::borrow(limbs, header->size);
+}
+
+bint_mapped_file::~bint_mapped_file() {
+    if (mapping != nullptr) ::munmap(mapping, length);
+}
+
+bint_mapped_file::bint_mapped_file(bint_mapped_file&& other) noexcept
+    : mapping(other.mapping), length(other.length), number(std::move(other.number)) {
+    other.mapping = nullptr;
+    other.length = 0;
+}
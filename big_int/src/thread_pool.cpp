@@ -0,0 +1,159 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include "big_int/thread_pool.h"
+
+using namespace big_int_impl;
+
+namespace {
+    std::unique_ptr<thread_pool> global_pool;
+    int global_thread_count = 1;
+    std::atomic<int> global_parallel_threshold = 1000;
+
+    // Index of the current worker in `current_pool`, -1 for threads outside of the pool
+    thread_local const thread_pool* current_pool = nullptr;
+    thread_local int current_worker = -1;
+}
+
+thread_pool::thread_pool(const int workers) {
+    for (int i = 0; i < std::max(workers, 1); i++) {
+        queues.push_back(std::make_unique<worker_queue>());
+    }
+    for (int i = 0; i < workers; i++) {
+        threads.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+thread_pool::~thread_pool() {
+    {
+        std::lock_guard lock(sleep_mutex);
+        stopping = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void thread_pool::submit(std::function<void()> task) {
+    const int index = current_pool == this
+        ? current_worker
+        : static_cast<int>(next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size());
+    {
+        std::lock_guard lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    pending.fetch_add(1, std::memory_order_release);
+    {
+        // Lock to avoid missing the wake-up of a worker that is going to sleep right now
+        std::lock_guard lock(sleep_mutex);
+    }
+    sleep_condition.notify_one();
+}
+
+bool thread_pool::try_pop(const int queue_index, const bool from_back, std::function<void()>& task) {
+    auto& queue = *queues[queue_index];
+    std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+
+    if (from_back) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+    } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+    }
+    pending.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool thread_pool::try_run_one() {
+    std::function<void()> task;
+    const int own = current_pool == this ? current_worker : -1;
+    bool found = own >= 0 && try_pop(own, true, task);
+
+    const int size = queues.size();
+    const int start = own >= 0 ? own + 1 : 0;
+    for (int i = 0; i < size && !found; i++) {
+        const int victim = (start + i) % size;
+        if (victim != own) found = try_pop(victim, false, task);
+    }
+
+    if (!found)
+        return false;
+
+    task();
+    return true;
+}
+
+void thread_pool::worker_loop(const int index) {
+    current_pool = this;
+    current_worker = index;
+    while (true) {
+        if (try_run_one())
+            continue;
+
+        std::unique_lock lock(sleep_mutex);
+        sleep_condition.wait(lock, [this] { return stopping || pending.load(std::memory_order_acquire) > 0; });
+        if (stopping)
+            return;
+    }
+}
+
+task_group::~task_group() {
+    // Tasks reference this group, never leave them running
+    while (pending.load(std::memory_order_acquire) > 0) {
+        if (!pool.try_run_one()) std::this_thread::yield();
+    }
+}
+
+void task_group::run(std::function<void()> task) {
+    pending.fetch_add(1, std::memory_order_relaxed);
+    pool.submit([this, task = std::move(task)] {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard lock(exception_mutex);
+            if (!exception) exception = std::current_exception();
+        }
+        pending.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+void task_group::wait() {
+    while (pending.load(std::memory_order_acquire) > 0) {
+        if (!pool.try_run_one()) std::this_thread::yield();
+    }
+    if (exception) std::rethrow_exception(exception);
+}
+
+thread_pool* big_int_impl::parallel_pool(const int n) {
+    if (n < global_parallel_threshold.load(std::memory_order_relaxed))
+        return nullptr;
+    return global_pool.get();
+}
+
+// ================ namespace big_int ================
+
+void big_int::set_thread_count(const int threads) {
+    global_pool.reset();
+    global_thread_count = std::max(threads, 1);
+    if (global_thread_count > 1) {
+        // The calling thread works as well while waiting for its tasks
+        global_pool = std::make_unique<thread_pool>(global_thread_count - 1);
+    }
+}
+
+int big_int::get_thread_count() {
+    return global_thread_count;
+}
+
+void big_int::set_parallel_threshold(const int limbs) {
+    global_parallel_threshold.store(limbs, std::memory_order_relaxed);
+}
+
+int big_int::get_parallel_threshold() {
+    return global_parallel_threshold.load(std::memory_order_relaxed);
+}
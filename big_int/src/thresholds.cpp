@@ -0,0 +1,129 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include "big_int/thresholds.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <variant>
+
+using namespace big_int;
+
+namespace {
+    // Constant-initialized, so the defaults are visible during the static initialization of other units
+    thresholds_t current_thresholds;
+
+    struct threshold_field {
+        const char* name;
+        std::variant<int thresholds_t::*, double thresholds_t::*> field;
+        double min_value;
+    };
+
+    // Karatsuba splits operands into two non-empty parts, Toom-3 into three, Toom-4 into four and Toom-6.5 into six,
+    // `to_string` splits only multi-limb numbers, the Newton reciprocal recurses into the highest `n / 2 + 2` limbs,
+    // slicing needs at least two slices, otherwise the product of the only slice is sliced again
+    const threshold_field threshold_fields[] = {
+        {"karatsuba", &thresholds_t::karatsuba, 2},
+        {"karatsuba_square", &thresholds_t::karatsuba_square, 2},
+        {"toom_cook", &thresholds_t::toom_cook, 5},
+        {"toom_cook_square", &thresholds_t::toom_cook_square, 5},
+        {"toom_4", &thresholds_t::toom_4, 10},
+        {"toom_4_square", &thresholds_t::toom_4_square, 10},
+        {"toom_6h", &thresholds_t::toom_6h, 26},
+        {"toom_6h_square", &thresholds_t::toom_6h_square, 26},
+        {"ntt", &thresholds_t::ntt, 1},
+        {"ntt_square", &thresholds_t::ntt_square, 1},
+        {"burnikel_ziegler", &thresholds_t::burnikel_ziegler, 2},
+        {"newton_division", &thresholds_t::newton_division, 5},
+        {"barrett_division", &thresholds_t::barrett_division, 2},
+        {"divexact_via_division", &thresholds_t::divexact_via_division, 1},
+        {"to_string", &thresholds_t::to_string, 2},
+        {"from_string", &thresholds_t::from_string, 1},
+        {"hgcd", &thresholds_t::hgcd, 4},
+        {"toom_32_ratio", &thresholds_t::toom_32_ratio, 1},
+        {"toom_42_ratio", &thresholds_t::toom_42_ratio, 1},
+        {"unbalanced_slice_ratio", &thresholds_t::unbalanced_slice_ratio, 2},
+    };
+
+    double get_value(const thresholds_t& thresholds, const threshold_field& field) {
+        return std::visit([&](auto member) { return static_cast<double>(thresholds.*member); }, field.field);
+    }
+
+    /**
+     * Runs during the static initialization, where an exception would terminate the process,
+     * so a broken file is reported to stderr and the defaults are kept
+     */
+    bool load_thresholds_from_environment() {
+        const char* path = std::getenv(THRESHOLDS_ENV_VARIABLE);
+        if (path == nullptr || *path == '\0')
+            return false;
+
+        try {
+            set_thresholds(load_thresholds(path, current_thresholds));
+            return true;
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "big_int: ignoring %s=%s: %s\n", THRESHOLDS_ENV_VARIABLE, path, e.what());
+            return false;
+        }
+    }
+
+    [[maybe_unused]] const bool loaded_from_environment = load_thresholds_from_environment();
+}
+
+const thresholds_t& big_int::get_thresholds() {
+    return current_thresholds;
+}
+
+void big_int::set_thresholds(const thresholds_t& thresholds) {
+    for (const auto& field : threshold_fields) {
+        if (!(get_value(thresholds, field) >= field.min_value)) {
+            throw std::invalid_argument(std::string("set_thresholds: ") + field.name + " must be at least "
+                + std::to_string(field.min_value));
+        }
+    }
+    current_thresholds = thresholds;
+}
+
+thresholds_t big_int::read_thresholds(std::istream& input, const thresholds_t& base) {
+    thresholds_t result = base;
+    std::string line;
+    for (int line_number = 1; std::getline(input, line); line_number++) {
+        if (const auto comment = line.find('#'); comment != std::string::npos)
+            line.resize(comment);
+
+        std::istringstream tokens(line);
+        std::string name, equals_sign;
+        double value;
+        if (!(tokens >> name))
+            continue;
+        if (!(tokens >> equals_sign >> value) || equals_sign != "=" || !(tokens >> std::ws).eof())
+            throw std::runtime_error("read_thresholds: invalid line " + std::to_string(line_number) + ": " + line);
+
+        bool found = false;
+        for (const auto& field : threshold_fields) {
+            if (name != field.name) continue;
+            std::visit([&]<typename T>(T thresholds_t::* member) { result.*member = static_cast<T>(value); }, field.field);
+            found = true;
+        }
+        if (!found)
+            throw std::runtime_error("read_thresholds: unknown threshold '" + name + "' at line " + std::to_string(line_number));
+    }
+    return result;
+}
+
+thresholds_t big_int::load_thresholds(const std::string& path, const thresholds_t& base) {
+    std::ifstream input(path);
+    if (!input)
+        throw std::runtime_error("load_thresholds: cannot open " + path);
+    return read_thresholds(input, base);
+}
+
+void big_int::write_thresholds(std::ostream& output, const thresholds_t& thresholds) {
+    for (const auto& field : threshold_fields) {
+        output << field.name << " = " << get_value(thresholds, field) << '\n';
+    }
+}
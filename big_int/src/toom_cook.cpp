@@ -4,162 +4,864 @@
 
 #include "big_int/toom_cook.h"
 #include "big_int/big_int_ops.h"
+#include "big_int/limbs.h"
+#include "big_int/thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <vector>
 
 using namespace big_int;
 using namespace big_int_impl;
 
-std::tuple<bint_t, bint_t, bint_t> split_abs_3way(const bint_t& a, const int a_limit, const int m) {
-    if (a_limit <= m) {
-        bint_t copy;
-        copy.data.resize(a_limit);
-        std::copy_n(a.data.begin(), a_limit, copy.data.begin());
-        return std::make_tuple(bint_t(0ll), bint_t(0ll), copy);
+/**
+ * Evaluates `a0 + a1 x + a2 x^2` in points 1, -1 and -2, where `a0`, `a1` have `m` limbs and `a2` has `k` limbs.
+ * Results have `m + 1` limbs, returns signs of values in -1 and -2.
+ */
+std::pair<bool, bool> toom3_evaluate(const uint64_t* a, const int m, const int k,
+                                     uint64_t* p_1, uint64_t* p_m1, uint64_t* p_m2) {
+    const uint64_t* a0 = a;
+    const uint64_t* a1 = a + m;
+    const uint64_t* a2 = a + 2 * m;
+
+    // p_m2 holds a0 + a2 until p_1 and p_m1 are computed
+    uint64_t* p0 = p_m2;
+    p0[m] = limbs_add(p0, a0, m, a2, k);
+    limbs_add(p_1, p0, m + 1, a1, m);
+    const bool m1_neg = limbs_add_signed(p_m1, p0, false, a1, m, true, m + 1);
+
+    // p(-2) = (p(-1) + a2) * 2 - a0
+    bool m2_neg = limbs_add_signed(p_m2, p_m1, m1_neg, a2, k, false, m + 1);
+    limbs_shift_left(p_m2, p_m2, m + 1, 1);
+    m2_neg = limbs_add_signed(p_m2, p_m2, m2_neg, a0, m, true, m + 1);
+    return std::make_pair(m1_neg, m2_neg);
+}
+
+/**
+ * Interpolation of Toom-3 in place: `r[0..2m-1]` holds r(0), `r[4m..2n-1]` holds r(inf),
+ * `w_1`, `w_m1` and `w_m2` hold r(1), r(-1) and r(-2) of `2m + 2` limbs. Values of `w_*` are destroyed.
+ */
+void toom3_interpolate(uint64_t* r, const int n, const int m,
+                       uint64_t* w_1, uint64_t* w_m1, const bool m1_neg, uint64_t* w_m2, const bool m2_neg) {
+    const int w_size = 2 * m + 2;
+    const uint64_t* w_0 = r;
+    const uint64_t* w_inf = r + 4 * m;
+    const int inf_size = 2 * n - 4 * m;
+
+    // r3 = (r(-2) - r(1)) / 3
+    bool r3_neg = limbs_add_signed(w_m2, w_m2, m2_neg, w_1, w_size, true, w_size);
+    if (limbs_divexact_1(w_m2, w_m2, w_size, 3) != 0)
+        throw std::runtime_error("toom3_interpolate: r(-2) - r(1) is not divisible by 3");
+
+    // r1 = (r(1) - r(-1)) / 2
+    bool r1_neg = limbs_add_signed(w_1, w_1, false, w_m1, w_size, !m1_neg, w_size);
+    limbs_shift_right(w_1, w_1, w_size, 1);
+
+    // r2 = r(-1) - r(0)
+    bool r2_neg = limbs_add_signed(w_m1, w_m1, m1_neg, w_0, 2 * m, true, w_size);
+
+    // r3 = (r2 - r3) / 2 + 2 * r(inf)
+    r3_neg = limbs_add_signed(w_m2, w_m1, r2_neg, w_m2, w_size, !r3_neg, w_size);
+    limbs_shift_right(w_m2, w_m2, w_size, 1);
+    r3_neg = limbs_add_signed(w_m2, w_m2, r3_neg, w_inf, inf_size, false, w_size);
+    r3_neg = limbs_add_signed(w_m2, w_m2, r3_neg, w_inf, inf_size, false, w_size);
+
+    // r2 = r2 + r1 - r(inf)
+    r2_neg = limbs_add_signed(w_m1, w_m1, r2_neg, w_1, w_size, r1_neg, w_size);
+    r2_neg = limbs_add_signed(w_m1, w_m1, r2_neg, w_inf, inf_size, true, w_size);
+
+    // r1 = r1 - r3
+    r1_neg = limbs_add_signed(w_1, w_1, r1_neg, w_m2, w_size, !r3_neg, w_size);
+    if (r1_neg || r2_neg || r3_neg)
+        throw std::runtime_error("toom3_interpolate: negative coefficient");
+
+    // Coefficients are below B^(2n - i * m), so their limbs above the result are zero
+    std::fill(r + 2 * m, r + 4 * m, 0);
+    limbs_add_inplace(r + m, 2 * n - m, w_1, std::min(w_size, 2 * n - m));
+    limbs_add_inplace(r + 2 * m, 2 * n - 2 * m, w_m1, std::min(w_size, 2 * n - 2 * m));
+    limbs_add_inplace(r + 3 * m, 2 * n - 3 * m, w_m2, std::min(w_size, 2 * n - 3 * m));
+}
+
+/**
+ * Scratch layout: [p(1), p(-1), p(-2), q(1), q(-1), q(-2) : m + 1 each][r(1), r(-1), r(-2) : 2m + 2 each][recursion]
+ */
+void toom3_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 2) / 3;
+    const int k = n - 2 * m;
+    const int p_size = m + 1;
+    const int w_size = 2 * m + 2;
+
+    uint64_t* p_1 = scratch;
+    uint64_t* p_m1 = p_1 + p_size;
+    uint64_t* p_m2 = p_m1 + p_size;
+    uint64_t* q_1 = p_m2 + p_size;
+    uint64_t* q_m1 = q_1 + p_size;
+    uint64_t* q_m2 = q_m1 + p_size;
+    uint64_t* w_1 = q_m2 + p_size;
+    uint64_t* w_m1 = w_1 + w_size;
+    uint64_t* w_m2 = w_m1 + w_size;
+    uint64_t* next = w_m2 + w_size;
+
+    const auto [p_m1_neg, p_m2_neg] = toom3_evaluate(a, m, k, p_1, p_m1, p_m2);
+    const auto [q_m1_neg, q_m2_neg] = toom3_evaluate(b, m, k, q_1, q_m1, q_m2);
+
+    if (thread_pool* pool = parallel_pool(n)) {
+        // Products write disjoint ranges, only one of them may use the shared recursion scratch
+        parallel_invoke(*pool,
+            [=] { limbs_mul_n(w_1, p_1, q_1, p_size, next); },
+            [=] { limbs_mul_n_alloc(w_m1, p_m1, q_m1, p_size); },
+            [=] { limbs_mul_n_alloc(w_m2, p_m2, q_m2, p_size); },
+            [=] { limbs_mul_n_alloc(r, a, b, m); },
+            [=] { limbs_mul_n_alloc(r + 4 * m, a + 2 * m, b + 2 * m, k); });
+    } else {
+        limbs_mul_n(w_1, p_1, q_1, p_size, next);
+        limbs_mul_n(w_m1, p_m1, q_m1, p_size, next);
+        limbs_mul_n(w_m2, p_m2, q_m2, p_size, next);
+        limbs_mul_n(r, a, b, m, next);
+        limbs_mul_n(r + 4 * m, a + 2 * m, b + 2 * m, k, next);
+    }
+
+    toom3_interpolate(r, n, m, w_1, w_m1, p_m1_neg ^ q_m1_neg, w_m2, p_m2_neg ^ q_m2_neg);
+}
+
+/**
+ * Scratch layout: [p(1), p(-1), p(-2) : m + 1 each][r(1), r(-1), r(-2) : 2m + 2 each][recursion]
+ */
+void toom3_square_n(uint64_t* r, const uint64_t* a, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 2) / 3;
+    const int k = n - 2 * m;
+    const int p_size = m + 1;
+    const int w_size = 2 * m + 2;
+
+    uint64_t* p_1 = scratch;
+    uint64_t* p_m1 = p_1 + p_size;
+    uint64_t* p_m2 = p_m1 + p_size;
+    uint64_t* w_1 = p_m2 + p_size;
+    uint64_t* w_m1 = w_1 + w_size;
+    uint64_t* w_m2 = w_m1 + w_size;
+    uint64_t* next = w_m2 + w_size;
+
+    toom3_evaluate(a, m, k, p_1, p_m1, p_m2);
+
+    if (thread_pool* pool = parallel_pool(n)) {
+        parallel_invoke(*pool,
+            [=] { limbs_square_n(w_1, p_1, p_size, next); },
+            [=] { limbs_square_n_alloc(w_m1, p_m1, p_size); },
+            [=] { limbs_square_n_alloc(w_m2, p_m2, p_size); },
+            [=] { limbs_square_n_alloc(r, a, m); },
+            [=] { limbs_square_n_alloc(r + 4 * m, a + 2 * m, k); });
+    } else {
+        limbs_square_n(w_1, p_1, p_size, next);
+        limbs_square_n(w_m1, p_m1, p_size, next);
+        limbs_square_n(w_m2, p_m2, p_size, next);
+        limbs_square_n(r, a, m, next);
+        limbs_square_n(r + 4 * m, a + 2 * m, k, next);
+    }
+
+    toom3_interpolate(r, n, m, w_1, w_m1, false, w_m2, false);
+}
+
+int toom3_mul_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 2) / 3;
+    const int recursion = std::max({limbs_mul_scratch_size(m + 1), limbs_mul_scratch_size(m), limbs_mul_scratch_size(n - 2 * m)});
+    return 6 * (m + 1) + 3 * (2 * m + 2) + recursion;
+}
+
+int toom3_square_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 2) / 3;
+    const int recursion = std::max({limbs_square_scratch_size(m + 1), limbs_square_scratch_size(m), limbs_square_scratch_size(n - 2 * m)});
+    return 3 * (m + 1) + 3 * (2 * m + 2) + recursion;
+}
+
+bint_t toom3(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
+
+    // One scratch buffer for the whole recursion: [padded a : n][padded b : n][recursion]
+    const int n = std::max(a_limit, b_limit);
+    std::vector<uint64_t> scratch(2 * n + toom3_mul_scratch_size(n));
+    const uint64_t* a_limbs = limbs_padded(a, a_limit, n, scratch.data());
+    const uint64_t* b_limbs = limbs_padded(b, b_limit, n, scratch.data() + n);
+
+    bint_t result;
+    result.data.resize(2 * n);
+    toom3_mul_n(result.data.data(), a_limbs, b_limbs, n, scratch.data() + 2 * n);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
+}
+
+void toom3_square(bint_t& a, int a_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+
+    std::vector<uint64_t> scratch(toom3_square_scratch_size(a_limit));
+    bint_t result;
+    result.data.resize(2 * a_limit);
+    toom3_square_n(result.data.data(), a.data.data(), a_limit, scratch.data());
+    a = std::move(result);
+    normalize(a);
+}
+
+// ================ Toom-4 and Toom-6.5 ================
+
+/**
+ * Interpolation value in the sign-magnitude form, the magnitude has the size of the point products
+ */
+struct toom_value {
+    uint64_t* limbs;
+    bool neg;
+};
+
+/**
+ * `x -= c * y` for `y` of `y_size <= size` limbs, the result must fit into `size` limbs
+ */
+void toom_submul(toom_value& x, const uint64_t* y, const int y_size, const bool y_neg, const uint64_t c, const int size) {
+    if (c == 1) {
+        x.neg = limbs_add_signed(x.limbs, x.limbs, x.neg, y, y_size, !y_neg, size);
+        return;
+    }
+
+    if (x.neg != y_neg) {
+        const uint64_t carry = limbs_addmul_1(x.limbs, y, y_size, c);
+        if (y_size < size) limbs_add_inplace(x.limbs + y_size, size - y_size, &carry, 1);
+        return;
+    }
+
+    const uint64_t borrow = limbs_submul_1(x.limbs, y, y_size, c);
+    const bool wrapped = y_size < size ? limbs_sub_inplace(x.limbs + y_size, size - y_size, &borrow, 1) != 0 : borrow != 0;
+    if (wrapped) {
+        // |x| < c |y|, the magnitude is in the two's complement
+        uint64_t carry = 1;
+        for (int i = 0; i < size; i++) {
+            x.limbs[i] = ~x.limbs[i] + carry;
+            carry &= x.limbs[i] == 0;
+        }
+        x.neg = !x.neg;
+    }
+}
+
+void toom_submul(toom_value& x, const toom_value& y, const uint64_t c, const int size) {
+    toom_submul(x, y.limbs, size, y.neg, c, size);
+}
+
+void toom_addmul(toom_value& x, const toom_value& y, const uint64_t c, const int size) {
+    toom_submul(x, y.limbs, size, !y.neg, c, size);
+}
+
+/**
+ * `x = c * y - x`
+ */
+void toom_rsubmul(toom_value& x, const toom_value& y, const uint64_t c, const int size) {
+    x.neg = !x.neg;
+    toom_submul(x, y.limbs, size, !y.neg, c, size);
+}
+
+void toom_divexact(toom_value& x, const uint64_t d, const int size) {
+    if (std::has_single_bit(d)) {
+        limbs_shift_right(x.limbs, x.limbs, size, std::countr_zero(d));
+    } else if (limbs_divexact_1(x.limbs, x.limbs, size, d) != 0) {
+        throw std::runtime_error("toom_divexact: the value is not divisible by " + std::to_string(d));
     }
+}
+
+/**
+ * Splits values in `x` and `-x` into the even part (in `w_x`) and the odd part divided by `x` (in `w_mx`)
+ */
+void toom_split(toom_value& w_x, toom_value& w_mx, const uint64_t x, const int size) {
+    toom_rsubmul(w_mx, w_x, 1, size);
+    toom_divexact(w_mx, 2, size);
+    toom_submul(w_x, w_mx, 1, size);
+    if (x != 1) toom_divexact(w_mx, x, size);
+}
+
+/**
+ * `r[0..m] = sum(c[i] * a_i)` over the pieces with `i % 2 == parity` (all pieces if `parity < 0`),
+ * `a` consists of `pieces` pieces of `m` limbs, the last one has `k` limbs
+ */
+void toom_combine_pieces(uint64_t* r, const uint64_t* a, const int m, const int k, const int pieces,
+                         const uint64_t* c, const int parity) {
+    std::fill_n(r, m + 1, 0);
+    for (int i = std::max(parity, 0); i < pieces; i += parity < 0 ? 1 : 2) {
+        const int size = i == pieces - 1 ? k : m;
+        const uint64_t carry = limbs_addmul_1(r, a + i * m, size, c[i]);
+        limbs_add_inplace(r + size, m + 1 - size, &carry, 1);
+    }
+}
 
-    bint_t low;
-    low.data.resize(m);
-    std::copy_n(a.data.begin(), m, low.data.begin());
-    normalize(low);
+/**
+ * Evaluates `a` in `x` and `-x` from its even and odd parts, `c[i]` is the weight of `a_i` in `x`.
+ * Results have `m + 1` limbs, `temp` is used for the even part. Returns the sign of the value in `-x`.
+ */
+bool toom_evaluate_pair(uint64_t* p_x, uint64_t* p_mx, uint64_t* temp, const uint64_t* a, const int m, const int k,
+                        const int pieces, const uint64_t* c) {
+    toom_combine_pieces(temp, a, m, k, pieces, c, 0);
+    toom_combine_pieces(p_mx, a, m, k, pieces, c, 1);
+    limbs_add(p_x, temp, m + 1, p_mx, m + 1);
+    return limbs_abs_diff(p_mx, temp, m + 1, p_mx, m + 1);
+}
 
-    bint_t mid;
-    mid.data.resize(std::min(m, a_limit - m));
-    std::copy_n(a.data.begin() + m, mid.data.size(), mid.data.begin());
-    normalize(mid);
+/**
+ * Products for the split into `pieces` pieces of size `m`: `2 pieces - 3` point values `w_i = p_i * q_i`
+ * of `m + 1` limbs, the lowest pieces into `r[0..2m-1]` and the highest pieces into `r[2(pieces-1)m..2n-1]`
+ */
+void toom_mul_points(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n, const int m, const int pieces,
+                     const uint64_t* p, const uint64_t* q, uint64_t* w, uint64_t* next) { // NOLINT(*-no-recursion)
+    const int count = 2 * pieces - 3;
+    const int p_size = m + 1;
+    const int w_size = 2 * m + 2;
+    const int high = (pieces - 1) * m;
 
-    if (a_limit <= 2 * m)
-        return std::make_tuple(bint_t(0ll), mid, low);
+    if (thread_pool* pool = parallel_pool(n)) {
+        // Products write disjoint ranges, only one of them may use the shared recursion scratch
+        task_group group(*pool);
+        group.run([=] { limbs_mul_n(w, p, q, p_size, next); });
+        for (int i = 1; i < count; i++) {
+            group.run([=] { limbs_mul_n_alloc(w + i * w_size, p + i * p_size, q + i * p_size, p_size); });
+        }
+        group.run([=] { limbs_mul_n_alloc(r, a, b, m); });
+        group.run([=] { limbs_mul_n_alloc(r + 2 * high, a + high, b + high, n - high); });
+        group.wait();
+    } else {
+        for (int i = 0; i < count; i++) {
+            limbs_mul_n(w + i * w_size, p + i * p_size, q + i * p_size, p_size, next);
+        }
+        limbs_mul_n(r, a, b, m, next);
+        limbs_mul_n(r + 2 * high, a + high, b + high, n - high, next);
+    }
+}
 
-    bint_t high;
-    high.data.resize(std::min(m, a_limit - 2 * m));
-    std::copy_n(a.data.begin() + 2 * m, high.data.size(), high.data.begin());
-    normalize(high);
+void toom_square_points(uint64_t* r, const uint64_t* a, const int n, const int m, const int pieces,
+                        const uint64_t* p, uint64_t* w, uint64_t* next) { // NOLINT(*-no-recursion)
+    const int count = 2 * pieces - 3;
+    const int p_size = m + 1;
+    const int w_size = 2 * m + 2;
+    const int high = (pieces - 1) * m;
 
-    return std::make_tuple(high, mid, low);
+    if (thread_pool* pool = parallel_pool(n)) {
+        task_group group(*pool);
+        group.run([=] { limbs_square_n(w, p, p_size, next); });
+        for (int i = 1; i < count; i++) {
+            group.run([=] { limbs_square_n_alloc(w + i * w_size, p + i * p_size, p_size); });
+        }
+        group.run([=] { limbs_square_n_alloc(r, a, m); });
+        group.run([=] { limbs_square_n_alloc(r + 2 * high, a + high, n - high); });
+        group.wait();
+    } else {
+        for (int i = 0; i < count; i++) {
+            limbs_square_n(w + i * w_size, p + i * p_size, p_size, next);
+        }
+        limbs_square_n(r, a, m, next);
+        limbs_square_n(r + 2 * high, a + high, n - high, next);
+    }
 }
 
-std::pair<bint_t, bint_t> split_abs_3way_inplace(bint_t& a, const int a_limit, const int m) {
-    if (a_limit <= 2 * m) {
-        throw std::runtime_error("split_abs_3way_inplace: a_limit [" + std::to_string(a_limit) +
-            "] <= 2 * m [" + std::to_string(2 * m) + "]");
+/**
+ * Adds the interpolated coefficients `r_1..r_count` to `r`, which holds `r_0` in `r[0..2m-1]`
+ * and `r_inf` from the limb `(count + 1) m`
+ */
+void toom_recompose_limbs(uint64_t* r, const int n, const int m, const toom_value* coefficients, const int count) {
+    const int w_size = 2 * m + 2;
+    for (int i = 0; i < count; i++) {
+        const auto& c = coefficients[i];
+        if (c.neg && std::any_of(c.limbs, c.limbs + w_size, [](const uint64_t limb) { return limb != 0; }))
+            throw std::runtime_error("toom_recompose_limbs: negative coefficient");
     }
 
-    bint_t mid;
-    mid.data.resize(std::min(m, a_limit - m));
-    std::copy_n(a.data.begin() + m, mid.data.size(), mid.data.begin());
-    normalize(mid);
+    // Coefficients are below B^(2n - i * m), so their limbs above the result are zero
+    std::fill(r + 2 * m, r + (count + 1) * m, 0);
+    for (int i = 1; i <= count; i++) {
+        limbs_add_inplace(r + i * m, 2 * n - i * m, coefficients[i - 1].limbs, std::min(w_size, 2 * n - i * m));
+    }
+}
+
+// ================ Toom-4 ================
+
+constexpr uint64_t toom4_weights_1[] = {1, 1, 1, 1};
+constexpr uint64_t toom4_weights_2[] = {1, 2, 4, 8};
+constexpr uint64_t toom4_weights_half[] = {8, 4, 2, 1};
+
+/**
+ * Evaluates `a0 + a1 x + a2 x^2 + a3 x^3` in points 1, -1, 2, -2 and 1/2 (multiplied by 8), where `a0`, `a1`, `a2`
+ * have `m` limbs and `a3` has `k` limbs. Results have `m + 1` limbs, returns signs of the values.
+ */
+std::array<bool, 5> toom4_evaluate(const uint64_t* a, const int m, const int k, uint64_t* p, uint64_t* temp) {
+    const int p_size = m + 1;
+    const bool m1_neg = toom_evaluate_pair(p, p + p_size, temp, a, m, k, 4, toom4_weights_1);
+    const bool m2_neg = toom_evaluate_pair(p + 2 * p_size, p + 3 * p_size, temp, a, m, k, 4, toom4_weights_2);
+    toom_combine_pieces(p + 4 * p_size, a, m, k, 4, toom4_weights_half, -1);
+    return {false, m1_neg, false, m2_neg, false};
+}
+
+/**
+ * Interpolation of Toom-4 in place: `r[0..2m-1]` holds r(0), `r[6m..2n-1]` holds r(inf), `w` holds r(1), r(-1),
+ * r(2), r(-2) and r(1/2) multiplied by 64 of `2m + 2` limbs each. Values of `w` are destroyed.
+ */
+void toom4_interpolate(uint64_t* r, const int n, const int m, uint64_t* w, const std::array<bool, 5>& neg) {
+    const int w_size = 2 * m + 2;
+    const uint64_t* r0 = r;
+    const uint64_t* r6 = r + 6 * m;
+    const int inf_size = 2 * n - 6 * m;
+    toom_value w_1{w, neg[0]};
+    toom_value w_m1{w + w_size, neg[1]};
+    toom_value w_2{w + 2 * w_size, neg[2]};
+    toom_value w_m2{w + 3 * w_size, neg[3]};
+    toom_value w_h{w + 4 * w_size, neg[4]};
+
+    // Even parts: w_1 = r0 + r2 + r4 + r6, w_2 = r0 + 4 r2 + 16 r4 + 64 r6,
+    // odd parts: w_m1 = r1 + r3 + r5, w_m2 = r1 + 4 r3 + 16 r5
+    toom_split(w_1, w_m1, 1, w_size);
+    toom_split(w_2, w_m2, 2, w_size);
+
+    // r4 = ((w_2 - r0 - 64 r6) / 4 - (w_1 - r0 - r6)) / 3, r2 = w_1 - r0 - r6 - r4
+    toom_submul(w_1, r0, 2 * m, false, 1, w_size);
+    toom_submul(w_1, r6, inf_size, false, 1, w_size);
+    toom_submul(w_2, r0, 2 * m, false, 1, w_size);
+    toom_submul(w_2, r6, inf_size, false, 64, w_size);
+    toom_divexact(w_2, 4, w_size);
+    toom_submul(w_2, w_1, 1, w_size);
+    toom_divexact(w_2, 3, w_size);
+    toom_submul(w_1, w_2, 1, w_size);
+
+    // w_h = 16 r1 + 4 r3 + r5
+    toom_submul(w_h, r0, 2 * m, false, 64, w_size);
+    toom_submul(w_h, w_1, 16, w_size);
+    toom_submul(w_h, w_2, 4, w_size);
+    toom_submul(w_h, r6, inf_size, false, 1, w_size);
+    toom_divexact(w_h, 2, w_size);
 
-    bint_t high;
-    high.data.resize(std::min(m, a_limit - 2 * m));
-    std::copy_n(a.data.begin() + 2 * m, high.data.size(), high.data.begin());
-    normalize(high);
+    // w_m2 = r3 + 5 r5, w_h = 5 r1 + r3, then r3 = (5 w_m1 - w_m2 - w_h) / 3
+    toom_submul(w_m2, w_m1, 1, w_size);
+    toom_divexact(w_m2, 3, w_size);
+    toom_submul(w_h, w_m1, 1, w_size);
+    toom_divexact(w_h, 3, w_size);
+    toom_addmul(w_h, w_m2, 1, w_size);
+    toom_rsubmul(w_h, w_m1, 5, w_size);
+    toom_divexact(w_h, 3, w_size);
 
-    a.sign = false;
-    a.data.resize(m);
+    // r5 = (w_m2 - r3) / 5, r1 = w_m1 - r3 - r5
+    toom_submul(w_m2, w_h, 1, w_size);
+    toom_divexact(w_m2, 5, w_size);
+    toom_submul(w_m1, w_h, 1, w_size);
+    toom_submul(w_m1, w_m2, 1, w_size);
+
+    const toom_value coefficients[] = {w_m1, w_1, w_h, w_2, w_m2};
+    toom_recompose_limbs(r, n, m, coefficients, 5);
+}
+
+/**
+ * Scratch layout: [p(1), p(-1), p(2), p(-2), p(1/2), q(...) : m + 1 each][r(...) : 2m + 2 each][recursion],
+ * evaluation uses the first product as a temporary
+ */
+void toom4_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 3) / 4;
+    const int k = n - 3 * m;
+    const int p_size = m + 1;
+
+    uint64_t* p = scratch;
+    uint64_t* q = p + 5 * p_size;
+    uint64_t* w = q + 5 * p_size;
+    uint64_t* next = w + 5 * (2 * m + 2);
+
+    const auto p_neg = toom4_evaluate(a, m, k, p, w);
+    const auto q_neg = toom4_evaluate(b, m, k, q, w);
+    toom_mul_points(r, a, b, n, m, 4, p, q, w, next);
+
+    std::array<bool, 5> w_neg;
+    for (int i = 0; i < 5; i++) w_neg[i] = p_neg[i] ^ q_neg[i];
+    toom4_interpolate(r, n, m, w, w_neg);
+}
+
+/**
+ * Scratch layout: [p(1), p(-1), p(2), p(-2), p(1/2) : m + 1 each][r(...) : 2m + 2 each][recursion]
+ */
+void toom4_square_n(uint64_t* r, const uint64_t* a, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 3) / 4;
+    const int k = n - 3 * m;
+
+    uint64_t* p = scratch;
+    uint64_t* w = p + 5 * (m + 1);
+    uint64_t* next = w + 5 * (2 * m + 2);
+
+    toom4_evaluate(a, m, k, p, w);
+    toom_square_points(r, a, n, m, 4, p, w, next);
+    toom4_interpolate(r, n, m, w, {});
+}
+
+int toom4_mul_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 3) / 4;
+    const int recursion = std::max({limbs_mul_scratch_size(m + 1), limbs_mul_scratch_size(m), limbs_mul_scratch_size(n - 3 * m)});
+    return 10 * (m + 1) + 5 * (2 * m + 2) + recursion;
+}
+
+int toom4_square_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 3) / 4;
+    const int recursion = std::max({limbs_square_scratch_size(m + 1), limbs_square_scratch_size(m), limbs_square_scratch_size(n - 3 * m)});
+    return 5 * (m + 1) + 5 * (2 * m + 2) + recursion;
+}
+
+bint_t toom4(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
+
+    // Padding to whole pieces keeps the highest piece non-empty for any size
+    const int n = (std::max(a_limit, b_limit) + 3) / 4 * 4;
+    std::vector<uint64_t> scratch(2 * n + toom4_mul_scratch_size(n));
+    const uint64_t* a_limbs = limbs_padded(a, a_limit, n, scratch.data());
+    const uint64_t* b_limbs = limbs_padded(b, b_limit, n, scratch.data() + n);
+
+    bint_t result;
+    result.data.resize(2 * n);
+    toom4_mul_n(result.data.data(), a_limbs, b_limbs, n, scratch.data() + 2 * n);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
+}
+
+void toom4_square(bint_t& a, int a_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+
+    // Scratch buffer: [padded a : n][recursion]
+    const int n = (a_limit + 3) / 4 * 4;
+    std::vector<uint64_t> scratch(n + toom4_square_scratch_size(n));
+    const uint64_t* a_limbs = limbs_padded(a, a_limit, n, scratch.data());
+
+    bint_t result;
+    result.data.resize(2 * n);
+    toom4_square_n(result.data.data(), a_limbs, n, scratch.data() + n);
+    a = std::move(result);
     normalize(a);
-    return std::make_pair(high, mid);
 }
 
-void div_abs_inplace_3_assert_rem(bint_t& a) {
-    __uint128_t current = 0;
-    for (int i = a.data.size() - 1; i >= 0; i--) {
-        current = (current << 64) + a.data[i];
-        a.data[i] = current / 3;
-        current %= 3;
+// ================ Toom-6.5 ================
+
+constexpr uint64_t toom6h_weights_1[] = {1, 1, 1, 1, 1, 1};
+constexpr uint64_t toom6h_weights_2[] = {1, 2, 4, 8, 16, 32};
+constexpr uint64_t toom6h_weights_4[] = {1, 4, 16, 64, 256, 1024};
+constexpr uint64_t toom6h_weights_half[] = {32, 16, 8, 4, 2, 1};
+constexpr uint64_t toom6h_weights_quarter[] = {1024, 256, 64, 16, 4, 1};
+
+/**
+ * Evaluates `a0 + a1 x + ... + a5 x^5` in points 1, -1, 2, -2, 4, -4, 1/2, -1/2 (multiplied by 32)
+ * and 1/4 (multiplied by 1024), where `a0..a4` have `m` limbs and `a5` has `k` limbs.
+ * Results have `m + 1` limbs, returns signs of the values.
+ */
+std::array<bool, 9> toom6h_evaluate(const uint64_t* a, const int m, const int k, uint64_t* p, uint64_t* temp) {
+    const int p_size = m + 1;
+    const bool m1_neg = toom_evaluate_pair(p, p + p_size, temp, a, m, k, 6, toom6h_weights_1);
+    const bool m2_neg = toom_evaluate_pair(p + 2 * p_size, p + 3 * p_size, temp, a, m, k, 6, toom6h_weights_2);
+    const bool m4_neg = toom_evaluate_pair(p + 4 * p_size, p + 5 * p_size, temp, a, m, k, 6, toom6h_weights_4);
+    const bool mh_neg = toom_evaluate_pair(p + 6 * p_size, p + 7 * p_size, temp, a, m, k, 6, toom6h_weights_half);
+    toom_combine_pieces(p + 8 * p_size, a, m, k, 6, toom6h_weights_quarter, -1);
+    return {false, m1_neg, false, m2_neg, false, m4_neg, false, mh_neg, false};
+}
+
+/**
+ * Interpolation of Toom-6.5 in place: `r[0..2m-1]` holds r(0), `r[10m..2n-1]` holds r(inf), `w` holds r(1), r(-1),
+ * r(2), r(-2), r(4), r(-4), r(1/2) and r(-1/2) multiplied by 2^10, r(1/4) multiplied by 4^10 of `2m + 2` limbs each.
+ * Values of `w` are destroyed.
+ */
+void toom6h_interpolate(uint64_t* r, const int n, const int m, uint64_t* w, const std::array<bool, 9>& neg) {
+    const int w_size = 2 * m + 2;
+    const uint64_t* r0 = r;
+    const uint64_t* r10 = r + 10 * m;
+    const int inf_size = 2 * n - 10 * m;
+    toom_value w_1{w, neg[0]};
+    toom_value w_m1{w + w_size, neg[1]};
+    toom_value w_2{w + 2 * w_size, neg[2]};
+    toom_value w_m2{w + 3 * w_size, neg[3]};
+    toom_value w_4{w + 4 * w_size, neg[4]};
+    toom_value w_m4{w + 5 * w_size, neg[5]};
+    toom_value w_h{w + 6 * w_size, neg[6]};
+    toom_value w_mh{w + 7 * w_size, neg[7]};
+    toom_value w_q{w + 8 * w_size, neg[8]};
+
+    toom_split(w_1, w_m1, 1, w_size);
+    toom_split(w_2, w_m2, 2, w_size);
+    toom_split(w_4, w_m4, 4, w_size);
+    toom_split(w_h, w_mh, 2, w_size);
+
+    // Even coefficients: w_1 = r2 + r4 + r6 + r8, w_2 = r2 + 4 r4 + 16 r6 + 64 r8,
+    // w_4 = r2 + 16 r4 + 256 r6 + 4096 r8, w_h = 64 r2 + 16 r4 + 4 r6 + r8
+    toom_submul(w_1, r0, 2 * m, false, 1, w_size);
+    toom_submul(w_1, r10, inf_size, false, 1, w_size);
+    toom_submul(w_2, r0, 2 * m, false, 1, w_size);
+    toom_submul(w_2, r10, inf_size, false, 1 << 10, w_size);
+    toom_divexact(w_2, 4, w_size);
+    toom_submul(w_4, r0, 2 * m, false, 1, w_size);
+    toom_submul(w_4, r10, inf_size, false, 1 << 20, w_size);
+    toom_divexact(w_4, 16, w_size);
+    toom_submul(w_h, r0, 2 * m, false, 1 << 10, w_size);
+    toom_submul(w_h, r10, inf_size, false, 1, w_size);
+    toom_divexact(w_h, 4, w_size);
+
+    toom_submul(w_4, w_2, 1, w_size);
+    toom_divexact(w_4, 12, w_size);
+    toom_submul(w_2, w_1, 1, w_size);
+    toom_divexact(w_2, 3, w_size);
+    toom_submul(w_4, w_2, 1, w_size);
+    toom_divexact(w_4, 15, w_size);
+    toom_rsubmul(w_h, w_1, 64, w_size);
+    toom_divexact(w_h, 3, w_size);
+    toom_rsubmul(w_h, w_2, 16, w_size);
+    toom_divexact(w_h, 15, w_size);
+    toom_submul(w_h, w_4, 1, w_size);
+    toom_divexact(w_h, 3, w_size);
+    toom_submul(w_4, w_h, 1, w_size);
+    toom_divexact(w_4, 21, w_size);
+    toom_submul(w_2, w_h, 5, w_size);
+    toom_submul(w_2, w_4, 21, w_size);
+    toom_submul(w_1, w_2, 1, w_size);
+    toom_submul(w_1, w_h, 1, w_size);
+    toom_submul(w_1, w_4, 1, w_size);
+
+    // Odd coefficients: w_m1 = r1 + r3 + r5 + r7 + r9, w_m2 = r1 + 4 r3 + 16 r5 + 64 r7 + 256 r9,
+    // w_m4 = r1 + 16 r3 + 256 r5 + 4096 r7 + 65536 r9, w_mh = 256 r1 + 64 r3 + 16 r5 + 4 r7 + r9,
+    // w_q = 65536 r1 + 4096 r3 + 256 r5 + 16 r7 + r9
+    toom_submul(w_q, r0, 2 * m, false, 1 << 20, w_size);
+    toom_submul(w_q, w_1, 1 << 16, w_size);
+    toom_submul(w_q, w_2, 1 << 12, w_size);
+    toom_submul(w_q, w_h, 1 << 8, w_size);
+    toom_submul(w_q, w_4, 1 << 4, w_size);
+    toom_submul(w_q, r10, inf_size, false, 1, w_size);
+    toom_divexact(w_q, 4, w_size);
+
+    toom_submul(w_m4, w_m2, 1, w_size);
+    toom_divexact(w_m4, 12, w_size);
+    toom_submul(w_m2, w_m1, 1, w_size);
+    toom_divexact(w_m2, 3, w_size);
+    toom_submul(w_m4, w_m2, 1, w_size);
+    toom_divexact(w_m4, 15, w_size);
+    toom_rsubmul(w_mh, w_m1, 256, w_size);
+    toom_divexact(w_mh, 3, w_size);
+    toom_rsubmul(w_mh, w_m2, 64, w_size);
+    toom_divexact(w_mh, 15, w_size);
+    toom_rsubmul(w_mh, w_m4, 16, w_size);
+    toom_divexact(w_mh, 63, w_size);
+    toom_rsubmul(w_q, w_m1, 1 << 16, w_size);
+    toom_divexact(w_q, 15, w_size);
+    toom_rsubmul(w_q, w_m2, 1 << 12, w_size);
+    toom_divexact(w_q, 63, w_size);
+    toom_rsubmul(w_q, w_m4, 1 << 8, w_size);
+    toom_divexact(w_q, 255, w_size);
+    toom_rsubmul(w_q, w_mh, 4, w_size);
+    toom_divexact(w_q, 3, w_size);
+    toom_submul(w_mh, w_q, 85, w_size);
+    toom_divexact(w_mh, 4, w_size);
+    toom_submul(w_m4, w_mh, 21, w_size);
+    toom_submul(w_m4, w_q, 357, w_size);
+    toom_submul(w_m2, w_m4, 5, w_size);
+    toom_submul(w_m2, w_mh, 21, w_size);
+    toom_submul(w_m2, w_q, 85, w_size);
+    toom_submul(w_m1, w_m2, 1, w_size);
+    toom_submul(w_m1, w_m4, 1, w_size);
+    toom_submul(w_m1, w_mh, 1, w_size);
+    toom_submul(w_m1, w_q, 1, w_size);
+
+    const toom_value coefficients[] = {w_m1, w_1, w_m2, w_2, w_m4, w_h, w_mh, w_4, w_q};
+    toom_recompose_limbs(r, n, m, coefficients, 9);
+}
+
+/**
+ * Scratch layout: [p(1), p(-1), p(2), p(-2), p(4), p(-4), p(1/2), p(-1/2), p(1/4), q(...) : m + 1 each]
+ * [r(...) : 2m + 2 each][recursion], evaluation uses the first product as a temporary
+ */
+void toom6h_mul_n(uint64_t* r, const uint64_t* a, const uint64_t* b, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 5) / 6;
+    const int k = n - 5 * m;
+    const int p_size = m + 1;
+
+    uint64_t* p = scratch;
+    uint64_t* q = p + 9 * p_size;
+    uint64_t* w = q + 9 * p_size;
+    uint64_t* next = w + 9 * (2 * m + 2);
+
+    const auto p_neg = toom6h_evaluate(a, m, k, p, w);
+    const auto q_neg = toom6h_evaluate(b, m, k, q, w);
+    toom_mul_points(r, a, b, n, m, 6, p, q, w, next);
+
+    std::array<bool, 9> w_neg;
+    for (int i = 0; i < 9; i++) w_neg[i] = p_neg[i] ^ q_neg[i];
+    toom6h_interpolate(r, n, m, w, w_neg);
+}
+
+/**
+ * Scratch layout: [p(1), p(-1), p(2), p(-2), p(4), p(-4), p(1/2), p(-1/2), p(1/4) : m + 1 each]
+ * [r(...) : 2m + 2 each][recursion]
+ */
+void toom6h_square_n(uint64_t* r, const uint64_t* a, const int n, uint64_t* scratch) { // NOLINT(*-no-recursion)
+    const int m = (n + 5) / 6;
+    const int k = n - 5 * m;
+
+    uint64_t* p = scratch;
+    uint64_t* w = p + 9 * (m + 1);
+    uint64_t* next = w + 9 * (2 * m + 2);
+
+    toom6h_evaluate(a, m, k, p, w);
+    toom_square_points(r, a, n, m, 6, p, w, next);
+    toom6h_interpolate(r, n, m, w, {});
+}
+
+int toom6h_mul_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 5) / 6;
+    const int recursion = std::max({limbs_mul_scratch_size(m + 1), limbs_mul_scratch_size(m), limbs_mul_scratch_size(n - 5 * m)});
+    return 18 * (m + 1) + 9 * (2 * m + 2) + recursion;
+}
+
+int toom6h_square_scratch_size(const int n) { // NOLINT(*-no-recursion)
+    const int m = (n + 5) / 6;
+    const int recursion = std::max({limbs_square_scratch_size(m + 1), limbs_square_scratch_size(m), limbs_square_scratch_size(n - 5 * m)});
+    return 9 * (m + 1) + 9 * (2 * m + 2) + recursion;
+}
+
+bint_t toom6h(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
+
+    // Padding to whole pieces keeps the highest piece non-empty for any size
+    const int n = (std::max(a_limit, b_limit) + 5) / 6 * 6;
+    std::vector<uint64_t> scratch(2 * n + toom6h_mul_scratch_size(n));
+    const uint64_t* a_limbs = limbs_padded(a, a_limit, n, scratch.data());
+    const uint64_t* b_limbs = limbs_padded(b, b_limit, n, scratch.data() + n);
+
+    bint_t result;
+    result.data.resize(2 * n);
+    toom6h_mul_n(result.data.data(), a_limbs, b_limbs, n, scratch.data() + 2 * n);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
+}
+
+void toom6h_square(bint_t& a, int a_limit) {
+    if (a_limit < 0) a_limit = a.data.size();
+
+    // Scratch buffer: [padded a : n][recursion]
+    const int n = (a_limit + 5) / 6 * 6;
+    std::vector<uint64_t> scratch(n + toom6h_square_scratch_size(n));
+    const uint64_t* a_limbs = limbs_padded(a, a_limit, n, scratch.data());
+
+    bint_t result;
+    result.data.resize(2 * n);
+    toom6h_square_n(result.data.data(), a_limbs, n, scratch.data() + n);
+    a = std::move(result);
+    normalize(a);
+}
+
+// ================ Unbalanced Toom ================
+
+/**
+ * Splits `a[0..a_limit-1]` into `k` normalized pieces of size `m`, lowest piece first
+ */
+std::vector<bint_t> split_abs_kway(const bint_t& a, const int a_limit, const int m, const int k) {
+    std::vector<bint_t> pieces(k);
+    for (int i = 0; i < k; i++) {
+        const int start = std::min(i * m, a_limit);
+        const int end = std::min((i + 1) * m, a_limit);
+        if (start == end) {
+            pieces[i] = bint_t(0);
+            continue;
+        }
+        pieces[i].data.resize(end - start);
+        std::copy_n(a.data.begin() + start, end - start, pieces[i].data.begin());
+        normalize(pieces[i]);
     }
-    while (a.data.size() > 1 && a.data.back() == 0) {
-        a.data.pop_back();
+    return pieces;
+}
+
+void divexact_abs_inplace_checked(bint_t& a, const uint64_t b) {
+    if (!divexact_abs_inplace(a, b))
+        throw std::runtime_error("divexact_abs_inplace_checked: the value is not divisible by " + std::to_string(b));
+}
+
+/**
+ * Computes `sum(r[i] << (64 * m * i))`, all `r[i]` must be non-negative
+ */
+template<typename Container>
+bint_t toom_recompose(Container& r, const int m) {
+    bint_t result = std::move(r[0]);
+    for (int i = 1; i < r.size(); i++) {
+        add_abs_inplace(result, r[i], 0, -1, i * m);
     }
-    if (current != 0) throw std::runtime_error("div_abs_inplace_3_assert_rem: rem was " +
-        std::to_string(static_cast<uint64_t>(current)) + ", a = " + a.to_string());
+    normalize(result);
+    return result;
 }
 
-bint_t toom3(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
+/**
+ * Toom-3/2: `a` is split into 3 pieces and `b` into 2 pieces of size `m`,
+ * product of degree 3 is evaluated in points 0, 1, -1 and infinity.
+ * Best suited for `a_limit` about 1.5 times larger than `b_limit`.
+ */
+bint_t toom32(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
     if (a_limit < 0) a_limit = a.data.size();
     if (b_limit < 0) b_limit = b.data.size();
+    if (a_limit < b_limit) return toom32(b, a, b_limit, a_limit);
+
+    const int m = std::max((a_limit + 2) / 3, (b_limit + 1) / 2);
+    const auto pa = split_abs_kway(a, a_limit, m, 3);
+    const auto pb = split_abs_kway(b, b_limit, m, 2);
+
+    const auto p0 = pa[0] + pa[2];
+    const auto w_1 = multiply(p0 + pa[1], pb[0] + pb[1]);
+    const auto w_m1 = multiply(p0 - pa[1], pb[0] - pb[1]);
 
-    int m = (std::max(a_limit, b_limit) + 2) / 3;
-    auto [a2, a1, a0] = split_abs_3way(a, a_limit, m);
-    auto [b2, b1, b0] = split_abs_3way(b, b_limit, m);
-
-    auto p0 = a0 + a2;
-    auto p_1 = p0 + a1;
-    auto p_m1 = p0 - a1;
-    auto p_m2 = p_m1 + a2;
-    p_m2 <<= 1;
-    p_m2 = p_m2 - a0;
-
-    auto q0 = b0 + b2;
-    auto q_1 = q0 + b1;
-    auto q_m1 = q0 - b1;
-    auto q_m2 = q_m1 + b2;
-    q_m2 <<= 1;
-    q_m2 = q_m2 - b0;
-
-    auto r_0 = multiply(a0, b0);
-    auto r_1 = multiply(p_1, q_1);
-    auto r_m1 = multiply(p_m1, q_m1);
-    auto r_m2 = multiply(p_m2, q_m2);
-    auto r_inf = multiply(a2, b2);
-
-    auto r4 = r_inf;
-    auto r3 = r_m2 - r_1;
-    div_abs_inplace_3_assert_rem(r3);
-    auto r1 = r_1 - r_m1;
-    r1 >>= 1;
-    auto r2 = r_m1 - r_0;
-    auto diff = r2 - r3;
-    r3 = r2 - r3;
-    r3 >>= 1;
-    r_inf <<= 1;
-    r3 = r3 + r_inf;
-    r2 = r2 + r1 - r4;
-    r1 = r1 - r3;
-
-    add_abs_inplace(r_0, r1, 0, -1, m);
-    add_abs_inplace(r_0, r2, 0, -1, 2 * m);
-    add_abs_inplace(r_0, r3, 0, -1, 3 * m);
-    add_abs_inplace(r_0, r4, 0, -1, 4 * m);
-    r_0.sign = a.sign ^ b.sign;
-    normalize(r_0);
-    return r_0;
+    std::array<bint_t, 4> r;
+    r[0] = multiply(pa[0], pb[0]);
+    r[3] = multiply(pa[2], pb[1]);
+    r[1] = w_1 - w_m1;
+    r[1] >>= 1;
+    r[1] -= r[3];
+    r[2] = w_1 + w_m1;
+    r[2] >>= 1;
+    r[2] -= r[0];
+
+    auto result = toom_recompose(r, m);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
 }
 
-void toom3_square(bint_t& a, int a_limit) {
+/**
+ * Toom-4/2: `a` is split into 4 pieces and `b` into 2 pieces of size `m`,
+ * product of degree 4 is evaluated in points 0, 1, -1, 2 and infinity.
+ * Best suited for `a_limit` about 2 times larger than `b_limit`.
+ */
+bint_t toom42(const bint_t& a, const bint_t& b, int a_limit, int b_limit) {
     if (a_limit < 0) a_limit = a.data.size();
+    if (b_limit < 0) b_limit = b.data.size();
+    if (a_limit < b_limit) return toom42(b, a, b_limit, a_limit);
+
+    const int m = std::max((a_limit + 3) / 4, (b_limit + 1) / 2);
+    const auto pa = split_abs_kway(a, a_limit, m, 4);
+    const auto pb = split_abs_kway(b, b_limit, m, 2);
+
+    const auto e = pa[0] + pa[2];
+    const auto o = pa[1] + pa[3];
+    const auto p_2 = pa[0] + (pa[1] << 1) + (pa[2] << 2) + (pa[3] << 3);
+    const auto w_1 = multiply(e + o, pb[0] + pb[1]);
+    const auto w_m1 = multiply(e - o, pb[0] - pb[1]);
+    const auto w_2 = multiply(p_2, pb[0] + (pb[1] << 1));
 
-    const int m = (a_limit + 2) / 3;
-    auto [a2, a1] = split_abs_3way_inplace(a, a_limit, m);
-
-    const auto p0 = a + a2;
-    auto p_1 = p0 + a1;
-    auto p_m1 = p0 - a1;
-    auto p_m2 = p_m1 + a2;
-    p_m2 <<= 1;
-    p_m2 = p_m2 - a;
-
-    square(a);
-    square(p_1);
-    square(p_m1);
-    square(p_m2);
-    square(a2);
-
-    const auto r4 = a2;
-    auto r3 = p_m2 - p_1;
-    div_abs_inplace_3_assert_rem(r3);
-    auto r1 = p_1 - p_m1;
-    r1 >>= 1;
-    auto r2 = p_m1 - a;
-    auto diff = r2 - r3;
-    r3 = r2 - r3;
-    r3 >>= 1;
-    a2 <<= 1;
-    r3 = r3 + a2;
-    r2 = r2 + r1 - r4;
-    r1 = r1 - r3;
-
-    add_abs_inplace(a, r1, 0, -1, m);
-    add_abs_inplace(a, r2, 0, -1, 2 * m);
-    add_abs_inplace(a, r3, 0, -1, 3 * m);
-    add_abs_inplace(a, r4, 0, -1, 4 * m);
-    normalize(a); // a.sign is already false from split_abs_3way_inplace
-}
\ No newline at end of file
+    std::array<bint_t, 5> r;
+    r[0] = multiply(pa[0], pb[0]);
+    r[4] = multiply(pa[3], pb[1]);
+
+    auto r1_plus_r3 = w_1 - w_m1;
+    r1_plus_r3 >>= 1;
+    r[2] = w_1 + w_m1;
+    r[2] >>= 1;
+    r[2] -= r[0];
+    r[2] -= r[4];
+
+    // r1 + 4 r3 = (w_2 - r0 - 4 r2 - 16 r4) / 2
+    auto r1_plus_4r3 = w_2 - r[0] - (r[2] << 2) - (r[4] << 4);
+    r1_plus_4r3 >>= 1;
+    r[3] = r1_plus_4r3 - r1_plus_r3;
+    divexact_abs_inplace_checked(r[3], 3);
+    r[1] = r1_plus_r3 - r[3];
+
+    auto result = toom_recompose(r, m);
+    result.sign = a.sign ^ b.sign;
+    normalize(result);
+    return result;
+}
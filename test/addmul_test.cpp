@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include "test_values.h"
+
+#include <random>
+
+TEST(AddmulTest, TestAgainstMultiplication) {
+    std::mt19937_64 random(42);
+    for (const int a_size : {0, 1, 2, 5, 40, 130}) {
+        for (const int b_size : {0, 1, 3, 17, 80}) {
+            for (const int c_size : {0, 1, 2, 9, 70}) {
+                for (int it = 0; it < 4; it++) {
+                    const bint_t a = random_signed_test_value(random, a_size);
+                    const bint_t b = random_signed_test_value(random, b_size);
+                    const bint_t c = random_signed_test_value(random, c_size);
+
+                    bint_t sum = a;
+                    big_int::addmul(sum, b, c);
+                    EXPECT_EQ(sum, a + b * c);
+
+                    bint_t difference = a;
+                    big_int::submul(difference, b, c);
+                    EXPECT_EQ(difference, a - b * c);
+
+                    bint_t fused = a;
+                    big_int::muladd(fused, b, c);
+                    EXPECT_EQ(fused, a * b + c);
+                }
+            }
+        }
+    }
+}
+
+TEST(AddmulTest, TestWordMultiplier) {
+    std::mt19937_64 random(7);
+    for (const int size : {0, 1, 2, 4, 5, 33}) {
+        for (const uint64_t c : {uint64_t(0), uint64_t(1), uint64_t(10), ~uint64_t(0), random()}) {
+            const bint_t a = random_signed_test_value(random, size);
+            const bint_t b = random_signed_test_value(random, size + random() % 3);
+            const bint_t product = b * bint_t(c);
+
+            bint_t sum = a;
+            big_int::addmul(sum, b, c);
+            EXPECT_EQ(sum, a + product);
+
+            bint_t difference = a;
+            big_int::submul(difference, b, c);
+            EXPECT_EQ(difference, a - product);
+        }
+    }
+}
+
+TEST(AddmulTest, TestCancellationAndAliasing) {
+    std::mt19937_64 random(3);
+    const bint_t b = random_signed_test_value(random, 6);
+    const bint_t c = random_signed_test_value(random, 3);
+
+    bint_t a = b * c;
+    big_int::submul(a, b, c);
+    EXPECT_EQ(a, bint_t(0));
+    EXPECT_FALSE(a.sign);
+
+    a = b;
+    big_int::addmul(a, a, c);
+    EXPECT_EQ(a, b + b * c);
+
+    a = b;
+    big_int::submul(a, c, a);
+    EXPECT_EQ(a, b - c * b);
+
+    a = b;
+    big_int::submul(a, a, 5);
+    EXPECT_EQ(a, b - b * bint_t(5));
+
+    a = c;
+    big_int::muladd(a, b, a);
+    EXPECT_EQ(a, c * b + c);
+}
@@ -118,4 +118,14 @@ TEST(BigTestWithPow, TestDivision) {
         "00145807218366270082009517876786362737418010332149994408455931989005955593484615895032745339552923540970554"
         "1669166520976073664713516503795067110957753101859132319158077244226900725453500752494845612587246639"
     );
-}
\ No newline at end of file
+}
+TEST(BigTestWithPow, TestToStringZeroGroups) {
+    EXPECT_EQ(bint_t(0).to_string(), "0");
+    EXPECT_EQ(bint_t(-7).to_string(), "-7");
+
+    bint_t power(10);
+    big_int::fast_pow_inplace(power, 76);
+    EXPECT_EQ(power.to_string(), "1" + std::string(76, '0'));
+    EXPECT_EQ((power + bint_t(5)).to_string(), "1" + std::string(75, '0') + "5");
+    EXPECT_EQ((power - bint_t(1)).to_string(), std::string(76, '9'));
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/bint_divisor.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    void set_barrett_threshold(const int barrett_division) {
+        big_int::thresholds_t thresholds;
+        thresholds.barrett_division = barrett_division;
+        big_int::set_thresholds(thresholds);
+    }
+}
+
+TEST(BintDivisorTest, TestDivmodMatchesOperators) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(14);
+    for (const int threshold : {2, 200}) {
+        set_barrett_threshold(threshold);
+        for (const int b_size : {1, 2, 3, 17, 64, 250}) {
+            for (const int a_size : {1, b_size, b_size + 1, 2 * b_size, 5 * b_size + 3}) {
+                for (int signs = 0; signs < 4; signs++) {
+                    const auto a = random_test_value(rng, a_size, signs & 1);
+                    const auto b = random_test_value(rng, b_size, signs & 2);
+                    const bint_divisor divisor(b);
+
+                    bint_t rem;
+                    EXPECT_EQ(divisor.divmod(a, rem), a / b) << "a_size = " << a_size << ", b_size = " << b_size;
+                    EXPECT_EQ(rem, a % b) << "a_size = " << a_size << ", b_size = " << b_size;
+                    EXPECT_EQ(divisor.mod(a), a % b);
+                }
+            }
+        }
+    }
+}
+
+TEST(BintDivisorTest, TestReuse) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(15);
+    set_barrett_threshold(2);
+    const auto b = random_test_value(rng, 40);
+    const bint_divisor divisor(b);
+    EXPECT_EQ(divisor.value(), b);
+    for (int it = 0; it < 20; it++) {
+        const auto q = random_test_value(rng, 1 + it * 7);
+        const auto r = random_test_value(rng, 40) % b;
+        // Exact multiples and remainders close to the divisor stress the correction steps
+        for (const auto& a : {q * b, q * b + r, q * b + b - bint_t(1), q * b - bint_t(1)}) {
+            bint_t quotient = a;
+            bint_t rem;
+            divisor.divide_abs(quotient, rem);
+            EXPECT_EQ(quotient * b + rem, a);
+            EXPECT_TRUE(big_int_impl::compare_abs(rem, b) < 0);
+            EXPECT_FALSE(rem.sign);
+        }
+    }
+}
+
+TEST(BintDivisorTest, TestReciprocalOnDemand) {
+    // The reciprocal is computed by the first Barrett division, even if the threshold is lowered after the construction
+    const thresholds_guard guard;
+    std::mt19937_64 rng(16);
+    const auto b = random_test_value(rng, 40);
+    const auto a = random_test_value(rng, 100);
+    const bint_divisor divisor(b);
+    EXPECT_EQ(divisor.mod(a), a % b);
+
+    set_barrett_threshold(2);
+    const bint_divisor copy = divisor;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&, i] {
+            const auto& used = i % 2 == 0 ? divisor : copy;
+            bint_t rem;
+            EXPECT_EQ(used.divmod(a, rem), a / b);
+            EXPECT_EQ(rem, a % b);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+}
+
+TEST(BintDivisorTest, TestZeroDivisor) {
+    EXPECT_THROW(bint_divisor(bint_t(0)), std::invalid_argument);
+    EXPECT_EQ(bint_divisor(bint_t(-7)).mod(bint_t(0)), bint_t(0));
+}
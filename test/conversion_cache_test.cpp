@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/conversion_cache.h>
+#include "test_values.h"
+
+#include <random>
+
+TEST(ConversionCacheTest, TestLimitAndClear) {
+    std::mt19937_64 rng(21);
+    const auto a = random_test_value(rng, 2000);
+    const auto expected = a.to_string();
+    const size_t default_limit = big_int::get_conversion_cache_limit();
+
+    big_int::clear_conversion_cache();
+    EXPECT_EQ(big_int::get_conversion_cache_size(), 0);
+    EXPECT_EQ(a.to_string(), expected);
+    const size_t size = big_int::get_conversion_cache_size();
+    EXPECT_GT(size, 0);
+    EXPECT_LE(size, default_limit);
+
+    // Powers are recomputed for every conversion, but the results are the same
+    big_int::set_conversion_cache_limit(size / 2);
+    EXPECT_LE(big_int::get_conversion_cache_size(), size / 2);
+    EXPECT_EQ(a.to_string(), expected);
+    EXPECT_EQ(bint_t::from_string(expected), a);
+    EXPECT_LE(big_int::get_conversion_cache_size(), size / 2);
+
+    big_int::set_conversion_cache_limit(0);
+    EXPECT_EQ(big_int::get_conversion_cache_size(), 0);
+    EXPECT_EQ(a.to_string(), expected);
+    EXPECT_EQ(big_int::get_conversion_cache_size(), 0);
+
+    big_int::set_conversion_cache_limit(default_limit);
+}
+
+TEST(ConversionCacheTest, TestPrewarm) {
+    big_int::clear_conversion_cache();
+    big_int::prewarm_conversion_cache(10, 100000);
+    // 10^65536 has 3402 limbs, it is stored with the normalized divisor and the reciprocal
+    EXPECT_GT(big_int::get_conversion_cache_size(), 3 * 8 * 3402);
+
+    const size_t size = big_int::get_conversion_cache_size();
+    EXPECT_EQ(big_int_impl::radix_power(10, 16)->value(), bint_t(10).pow(65536));
+    EXPECT_EQ(big_int::get_conversion_cache_size(), size);
+
+    // Powers of two radixes are converted without powers
+    big_int::prewarm_conversion_cache(16, 100000);
+    EXPECT_EQ(big_int::get_conversion_cache_size(), size);
+    EXPECT_THROW(big_int::prewarm_conversion_cache(1, 10), std::invalid_argument);
+}
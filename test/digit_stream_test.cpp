@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> collect_chunks(const bint_t& a, const int radix, const size_t chunk_size) {
+        std::vector<std::string> chunks;
+        a.write_digits([&](const std::string_view chunk) { chunks.emplace_back(chunk); }, radix, chunk_size);
+        return chunks;
+    }
+}
+
+TEST(DigitStreamTest, TestChunksMatchToString) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(22);
+    big_int::thresholds_t thresholds;
+    thresholds.to_string = 2;
+    big_int::set_thresholds(thresholds);
+
+    std::vector<bint_t> values = {bint_t(0), bint_t(-7), bint_t(UINT64_MAX)};
+    for (const int size : {2, 30, 700}) {
+        values.push_back(random_test_value(rng, size));
+        values.push_back(-random_test_value(rng, size));
+    }
+    for (const auto& a : values) {
+        for (const int radix : {10, 2, 7, 8, 16, 32, 36}) {
+            const auto expected = a.to_string(radix);
+            for (const size_t chunk_size : {1, 7, 64, 1000, 1 << 16}) {
+                const auto chunks = collect_chunks(a, radix, chunk_size);
+                std::string joined;
+                for (size_t i = 0; i < chunks.size(); i++) {
+                    if (i + 1 < chunks.size()) {
+                        EXPECT_EQ(chunks[i].size(), chunk_size);
+                    }
+                    joined += chunks[i];
+                }
+                EXPECT_EQ(joined, expected) << "radix = " << radix << ", chunk_size = " << chunk_size;
+            }
+        }
+    }
+}
+
+TEST(DigitStreamTest, TestStreamAndFile) {
+    std::mt19937_64 rng(23);
+    const auto a = -random_test_value(rng, 5000);
+    const auto expected = a.to_string();
+
+    std::ostringstream stream;
+    a.write_digits(stream);
+    EXPECT_EQ(stream.str(), expected);
+
+    FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    a.write_digits_to_fd(fileno(file), 16);
+    std::rewind(file);
+    std::string written(a.to_string(16).size() + 1, '\0');
+    written.resize(std::fread(written.data(), 1, written.size(), file));
+    std::fclose(file);
+    EXPECT_EQ(written, a.to_string(16));
+
+    EXPECT_THROW(a.write_digits_to_fd(-1), std::system_error);
+    EXPECT_THROW(a.write_digits([](std::string_view) {}, 10, 0), std::invalid_argument);
+}
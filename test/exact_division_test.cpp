@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/limbs.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+TEST(ExactDivisionTest, TestLimbsDivexact1) {
+    std::mt19937_64 rng(16);
+    for (const uint64_t b : {1ull, 3ull, 5ull, 12ull, 1ull << 40, 0xffffffffffffffffull, 0x8000000000000001ull}) {
+        for (const int size : {1, 2, 7, 30}) {
+            std::vector<uint64_t> q(size);
+            for (auto& limb : q) limb = rng();
+            q.back() >>= 1;
+            std::vector<uint64_t> a(size + 1);
+            a[size] = big_int_impl::limbs_mul_1(a.data(), q.data(), size, b);
+
+            std::vector<uint64_t> r(size + 1);
+            EXPECT_EQ(big_int_impl::limbs_divexact_1(r.data(), a.data(), size + 1, b), 0) << "b = " << b;
+            r.resize(size);
+            EXPECT_EQ(r, q) << "b = " << b << ", size = " << size;
+
+            if (b > 1) {
+                a[0]++;
+                EXPECT_NE(big_int_impl::limbs_divexact_1(r.data(), a.data(), size + 1, b), 0) << "b = " << b;
+            }
+        }
+    }
+}
+
+TEST(ExactDivisionTest, TestDivexactMatchesDivision) {
+    std::mt19937_64 rng(17);
+    for (const int b_size : {1, 2, 5, 40}) {
+        for (const int q_size : {1, 3, 40, 120}) {
+            for (int it = 0; it < 4; it++) {
+                auto b = random_test_value(rng, b_size);
+                if (it & 1) b <<= 1 + rng() % 130;
+                b.sign = it & 2;
+                auto q = random_test_value(rng, q_size);
+                q.sign = it == 1;
+                const auto a = q * b;
+                EXPECT_EQ(big_int::divexact(a, b), q) << "b_size = " << b_size << ", q_size = " << q_size << ", it = " << it;
+                EXPECT_EQ(big_int::divexact(a, b), a / b);
+            }
+        }
+    }
+    EXPECT_EQ(big_int::divexact(bint_t(0), bint_t(7)), bint_t(0));
+    EXPECT_THROW(big_int::divexact(bint_t(7), bint_t(0)), std::invalid_argument);
+}
+
+TEST(ExactDivisionTest, TestDivexactViaDivision) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(18);
+    big_int::thresholds_t thresholds;
+    thresholds.divexact_via_division = 4;
+    big_int::set_thresholds(thresholds);
+    for (const int size : {3, 4, 20}) {
+        const auto b = random_test_value(rng, size);
+        auto q = random_test_value(rng, size + 1);
+        q.sign = true;
+        EXPECT_EQ(big_int::divexact(q * b, b), q) << "size = " << size;
+    }
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+
+TEST(FromStringTest, TestSmallValues) {
+    EXPECT_EQ(bint_t::from_string("0"), bint_t(0));
+    EXPECT_EQ(bint_t::from_string("-0"), bint_t(0));
+    EXPECT_FALSE(bint_t::from_string("-0").sign);
+    EXPECT_EQ(bint_t::from_string("000123"), bint_t(123));
+    EXPECT_EQ(bint_t::from_string("-9223372036854775808"), bint_t(INT64_MIN));
+    EXPECT_EQ(bint_t::from_string("18446744073709551615"), bint_t(UINT64_MAX));
+    EXPECT_EQ(bint_t::from_string("18446744073709551616"), bint_t(1) << 64);
+    EXPECT_EQ(bint_t::from_string("10000000000000000000"), bint_t(10000000000000000000ull));
+}
+
+TEST(FromStringTest, TestRoundTrip) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(19);
+    for (const int threshold : {1, 20}) {
+        big_int::thresholds_t thresholds;
+        thresholds.from_string = threshold;
+        big_int::set_thresholds(thresholds);
+        for (const int size : {1, 2, 7, 20, 21, 64, 300, 1000}) {
+            auto a = random_test_value(rng, size);
+            a.sign = size % 2 == 1;
+            EXPECT_EQ(bint_t::from_string(a.to_string()), a) << "size = " << size << ", threshold = " << threshold;
+        }
+
+        const auto power = bint_t(10).pow(1000);
+        EXPECT_EQ(bint_t::from_string("1" + std::string(1000, '0')), power);
+        EXPECT_EQ(bint_t::from_string(std::string(1000, '9')), power - bint_t(1));
+        EXPECT_EQ(bint_t::from_string(std::string(500, '0') + "42"), bint_t(42));
+    }
+}
+
+TEST(FromStringTest, TestInvalidInput) {
+    for (const char* str : {"", "-", "+1", "12a", " 1", "1 ", "--1", "0x10"}) {
+        EXPECT_THROW(bint_t::from_string(str), std::invalid_argument) << "str = \"" << str << "\"";
+    }
+}
+
+TEST(FromStringTest, TestFromChars) {
+    const std::string str = "-12345678901234567890123xyz";
+    bint_t value(7);
+    auto [end, error] = bint_t::from_chars(str.data(), str.data() + str.size(), value);
+    EXPECT_EQ(error, std::errc());
+    EXPECT_EQ(end, str.data() + 24);
+    EXPECT_EQ(value, -bint_t::from_string("12345678901234567890123"));
+
+    const std::string invalid = "x1";
+    const auto result = bint_t::from_chars(invalid.data(), invalid.data() + invalid.size(), value);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+    EXPECT_EQ(result.ptr, invalid.data());
+    EXPECT_EQ(value, -bint_t::from_string("12345678901234567890123"));
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+#include <stdexcept>
+
+namespace {
+    bint_t euclid_gcd(bint_t a, bint_t b) {
+        a.sign = b.sign = false;
+        while (b != bint_t(0)) {
+            a = a % b;
+            std::swap(a, b);
+        }
+        return a;
+    }
+
+    /**
+     * Checks the GCD against the Euclid algorithm and the cofactors against their definition
+     */
+    void check_gcd(const bint_t& a, const bint_t& b) {
+        const bint_t expected = euclid_gcd(a, b);
+        EXPECT_EQ(big_int::gcd(a, b), expected);
+        bint_t s, t;
+        const bint_t g = big_int::gcdext(a, b, s, t);
+        EXPECT_EQ(g, expected);
+        EXPECT_EQ(a * s + b * t, g);
+        if (b != bint_t(0)) {
+            bint_t b_over_g = b / g;
+            b_over_g.sign = false;
+            EXPECT_GE(s, bint_t(0));
+            EXPECT_LT(s, b_over_g);
+        }
+    }
+}
+
+TEST(GcdTest, TestSmallValues) {
+    EXPECT_EQ(big_int::gcd(bint_t(0), bint_t(0)), bint_t(0));
+    EXPECT_EQ(big_int::gcd(bint_t(0), bint_t(-7)), bint_t(7));
+    EXPECT_EQ(big_int::gcd(bint_t(12), bint_t(-18)), bint_t(6));
+    for (const int a : {0, 1, -1, 2, 6, -15, 35, 97, -128}) {
+        for (const int b : {0, 1, -1, 3, -6, 10, 64, -97}) {
+            check_gcd(bint_t(a), bint_t(b));
+        }
+    }
+
+    bint_t s, t;
+    EXPECT_EQ(big_int::gcdext(bint_t(-5), bint_t(0), s, t), bint_t(5));
+    EXPECT_EQ(s, bint_t(-1));
+    EXPECT_EQ(t, bint_t(0));
+}
+
+TEST(GcdTest, TestRandomValues) {
+    std::mt19937_64 rng(25);
+    for (const int a_size : {1, 2, 3, 8, 40}) {
+        for (const int b_size : {1, 2, 7, 40}) {
+            for (int it = 0; it < 4; it++) {
+                const auto common = random_test_value(rng, 1 + it);
+                auto a = random_test_value(rng, a_size) * common;
+                auto b = random_test_value(rng, b_size) * common;
+                a.sign = it % 2 == 1;
+                b.sign = it / 2 == 1;
+                check_gcd(a, b);
+            }
+        }
+    }
+}
+
+TEST(GcdTest, TestConsecutiveFibonacci) {
+    // Consecutive Fibonacci numbers take the longest chain of Euclid steps, all of them with the quotient 1
+    bint_t a(1), b(1);
+    for (int i = 0; i < 3000; i++) {
+        a += b;
+        std::swap(a, b);
+    }
+    check_gcd(a, b);
+    check_gcd(b, a);
+}
+
+TEST(GcdTest, TestHalfGcd) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(26);
+    big_int::thresholds_t thresholds;
+    thresholds.hgcd = 4;
+    big_int::set_thresholds(thresholds);
+    for (const int size : {5, 17, 64, 300}) {
+        for (const int common_size : {1, size / 2}) {
+            const auto common = random_test_value(rng, common_size);
+            const auto a = random_test_value(rng, size) * common;
+            const auto b = -random_test_value(rng, size - 1) * common;
+            check_gcd(a, b);
+            check_gcd(b, a);
+        }
+    }
+}
+
+TEST(GcdTest, TestModularInverse) {
+    std::mt19937_64 rng(27);
+    // 2^521 - 1 is prime
+    const bint_t prime = (bint_t(1) << 521) - bint_t(1);
+    for (const int size : {1, 3, 9}) {
+        auto a = random_test_value(rng, size);
+        a.sign = size == 3;
+        const auto inverse = big_int::modinv(a, prime);
+        EXPECT_GE(inverse, bint_t(0));
+        EXPECT_LT(inverse, prime);
+        EXPECT_EQ(a * inverse % prime, bint_t(1)) << "size = " << size;
+    }
+    EXPECT_EQ(big_int::modinv(bint_t(3), bint_t(10)), bint_t(7));
+    EXPECT_EQ(big_int::modinv(bint_t(-3), bint_t(10)), bint_t(3));
+    EXPECT_EQ(big_int::modinv(bint_t(5), bint_t(1)), bint_t(0));
+
+    EXPECT_THROW(big_int::modinv(bint_t(6), bint_t(10)), std::invalid_argument);
+    EXPECT_THROW(big_int::modinv(bint_t(0), bint_t(10)), std::invalid_argument);
+    EXPECT_THROW(big_int::modinv(bint_t(3), bint_t(0)), std::invalid_argument);
+    EXPECT_THROW(big_int::modinv(bint_t(3), bint_t(-7)), std::invalid_argument);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/limb_vector.h>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+TEST(LimbVectorTest, TestInlineStorage) {
+    limb_vector a;
+    for (uint64_t i = 0; i < limb_vector::INLINE_CAPACITY; i++) a.push_back(i + 1);
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(a.size(), limb_vector::INLINE_CAPACITY);
+
+    a.push_back(100);
+    EXPECT_FALSE(a.is_inline());
+    EXPECT_EQ(a, limb_vector({1, 2, 3, 4, 100}));
+
+    a.resize(2);
+    EXPECT_EQ(a, limb_vector({1, 2}));
+    a.resize(7);
+    EXPECT_EQ(a, limb_vector({1, 2, 0, 0, 0, 0, 0}));
+}
+
+TEST(LimbVectorTest, TestCopyAndMove) {
+    for (const int size : {0, 3, 4, 5, 100}) {
+        limb_vector a(size, 7);
+        const limb_vector copy = a;
+        EXPECT_EQ(copy, a);
+
+        limb_vector moved = std::move(a);
+        EXPECT_EQ(moved, copy);
+        EXPECT_TRUE(a.empty());
+
+        limb_vector assigned({1, 2, 3, 4, 5, 6});
+        assigned = std::move(moved);
+        EXPECT_EQ(assigned, copy);
+
+        assigned = limb_vector({9});
+        EXPECT_EQ(assigned, limb_vector({9}));
+        assigned.swap(moved);
+        EXPECT_TRUE(assigned.empty());
+        EXPECT_EQ(moved, limb_vector({9}));
+    }
+}
+
+TEST(LimbVectorTest, TestVectorInterface) {
+    // Mirrors every operation on std::vector, crossing the inline capacity in both directions
+    limb_vector a({1, 2, 3});
+    std::vector<uint64_t> expected = a;
+    EXPECT_EQ(expected, std::vector<uint64_t>({1, 2, 3}));
+
+    EXPECT_EQ(*a.insert(a.begin() + 1, 10), 10);
+    expected.insert(expected.begin() + 1, 10);
+    a.insert(a.end(), 3, 20);
+    expected.insert(expected.end(), 3, 20);
+    a.insert(a.begin(), a.begin() + 2, a.end());
+    expected.insert(expected.begin(), expected.begin() + 2, expected.end());
+    EXPECT_EQ(std::vector<uint64_t>(a), expected);
+
+    EXPECT_EQ(*a.erase(a.begin() + 2), expected[3]);
+    expected.erase(expected.begin() + 2);
+    a.erase(a.begin(), a.end() - 2);
+    expected.erase(expected.begin(), expected.end() - 2);
+    EXPECT_EQ(std::vector<uint64_t>(a), expected);
+
+    EXPECT_EQ(a.at(1), expected.at(1));
+    EXPECT_THROW(a.at(2), std::out_of_range);
+
+    bint_t b(5);
+    b.data = expected;
+    EXPECT_EQ(b.data, limb_vector(expected));
+}
+
+TEST(LimbVectorTest, TestSmallNumbersDontAllocate) {
+    const bint_t a(static_cast<int64_t>(-12345));
+    const bint_t b(static_cast<uint64_t>(1) << 63);
+    const bint_t product = a * b * b;
+    EXPECT_TRUE(product.data.is_inline());
+    EXPECT_TRUE((product / b).data.is_inline());
+    EXPECT_EQ(product / b / b, a);
+    EXPECT_EQ((product % a), bint_t(0));
+}
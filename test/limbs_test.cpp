@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <big_int/comba.h>
+#include <big_int/limbs.h>
+#include <big_int/limbs_x86_64.h>
+
+#include <random>
+#include <vector>
+
+using namespace big_int_impl;
+
+std::vector<uint64_t> get_limbs_test_value(std::mt19937_64& rng, const int size, const bool all_ones = false) {
+    std::vector<uint64_t> a(size);
+    for (auto& limb : a) limb = all_ones ? ~0ull : rng();
+    return a;
+}
+
+/**
+ * Reference `r += sign * a * b` with `__uint128_t` arithmetic, returns the carry or the borrow limb
+ */
+uint64_t reference_addmul_1(std::vector<uint64_t>& r, const std::vector<uint64_t>& a, const uint64_t b, const bool subtract) {
+    uint64_t carry = 0;
+    for (int i = 0; i < a.size(); i++) {
+        const __uint128_t product = static_cast<__uint128_t>(a[i]) * b + carry;
+        const auto low = static_cast<uint64_t>(product);
+        carry = static_cast<uint64_t>(product >> 64);
+        if (subtract) {
+            carry += r[i] < low;
+            r[i] -= low;
+        } else {
+            carry += __builtin_add_overflow(r[i], low, &r[i]);
+        }
+    }
+    return carry;
+}
+
+TEST(LimbsTest, TestMultiplyAccumulateKernels) {
+    std::mt19937_64 rng(6);
+    for (int n = 0; n <= 21; n++) {
+        for (const bool all_ones : {false, true}) {
+            const auto a = get_limbs_test_value(rng, n, all_ones);
+            const auto r = get_limbs_test_value(rng, n, all_ones);
+            const uint64_t b = all_ones ? ~0ull : rng();
+
+            auto expected = std::vector<uint64_t>(n);
+            auto actual = std::vector<uint64_t>(n);
+            const uint64_t expected_mul = reference_addmul_1(expected, a, b, false);
+            EXPECT_EQ(limbs_mul_1(actual.data(), a.data(), n, b), expected_mul);
+            EXPECT_EQ(actual, expected);
+
+            for (const bool subtract : {false, true}) {
+                expected = r;
+                actual = r;
+                const uint64_t expected_carry = reference_addmul_1(expected, a, b, subtract);
+                const uint64_t carry = subtract
+                    ? limbs_submul_1(actual.data(), a.data(), n, b)
+                    : limbs_addmul_1(actual.data(), a.data(), n, b);
+                EXPECT_EQ(carry, expected_carry) << "n = " << n << ", subtract = " << subtract;
+                EXPECT_EQ(actual, expected) << "n = " << n << ", subtract = " << subtract;
+            }
+        }
+    }
+}
+
+/**
+ * Reference `a * b` through rows of `reference_addmul_1`
+ */
+std::vector<uint64_t> reference_mul(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+    std::vector<uint64_t> result(a.size() + b.size());
+    for (int i = 0; i < b.size(); i++) {
+        std::vector<uint64_t> row(result.begin() + i, result.begin() + i + a.size());
+        result[i + a.size()] = reference_addmul_1(row, a, b[i], false);
+        std::copy(row.begin(), row.end(), result.begin() + i);
+    }
+    return result;
+}
+
+TEST(LimbsTest, TestCombaKernels) {
+    std::mt19937_64 rng(16);
+    for (int n = 1; n <= COMBA_MAX_SIZE; n++) {
+        for (int m = 1; m <= COMBA_MAX_SIZE; m++) {
+            const bool all_ones = (n + m) % 3 == 0;
+            const auto a = get_limbs_test_value(rng, n, all_ones);
+            const auto b = get_limbs_test_value(rng, m, all_ones);
+            std::vector<uint64_t> result(n + m);
+            comba_mul(result.data(), a.data(), n, b.data(), m);
+            EXPECT_EQ(result, reference_mul(a, b)) << "n = " << n << ", m = " << m;
+        }
+
+        for (const bool all_ones : {false, true}) {
+            const auto a = get_limbs_test_value(rng, n, all_ones);
+            std::vector<uint64_t> result(2 * n);
+            comba_square(result.data(), a.data(), n);
+            EXPECT_EQ(result, reference_mul(a, a)) << "n = " << n;
+        }
+    }
+}
+
+#if defined(__x86_64__)
+TEST(LimbsTest, TestAdxKernelsMatchReference) {
+    if (!cpu_supports_mulx_adx()) GTEST_SKIP() << "CPU doesn't support BMI2 and ADX";
+
+    std::mt19937_64 rng(66);
+    for (int iteration = 0; iteration < 200; iteration++) {
+        const int n = rng() % 40;
+        const auto a = get_limbs_test_value(rng, n, iteration % 5 == 0);
+        const uint64_t b = iteration % 7 == 0 ? ~0ull : rng();
+        auto expected = get_limbs_test_value(rng, n);
+        auto actual = expected;
+        const bool subtract = iteration % 2 == 1;
+        const uint64_t expected_carry = reference_addmul_1(expected, a, b, subtract);
+        const uint64_t carry = subtract
+            ? limbs_submul_1_adx(actual.data(), a.data(), n, b)
+            : limbs_addmul_1_adx(actual.data(), a.data(), n, b);
+        EXPECT_EQ(carry, expected_carry);
+        EXPECT_EQ(actual, expected);
+    }
+}
+#endif
+
+TEST(LimbsTest, TestInvariantWordDivision) {
+    std::mt19937_64 rng(23);
+    for (const uint64_t b : {uint64_t(1), uint64_t(3), uint64_t(10), uint64_t(1) << 63, ~uint64_t(0),
+                             uint64_t(10000000000000000000ull), rng(), rng() >> 17}) {
+        for (const int size : {1, 2, 5, 40}) {
+            const auto a = get_limbs_test_value(rng, size, size == 5);
+            std::vector<uint64_t> expected(size), result(size);
+            __uint128_t current = 0;
+            for (int i = size - 1; i >= 0; i--) {
+                current = current << 64 | a[i];
+                expected[i] = static_cast<uint64_t>(current / b);
+                current %= b;
+            }
+
+            const big_int_impl::limb_divisor divisor(b);
+            EXPECT_EQ(big_int_impl::limbs_div_1(result.data(), a.data(), size, divisor), static_cast<uint64_t>(current));
+            EXPECT_EQ(result, expected);
+            EXPECT_EQ(big_int_impl::limbs_div_1(result.data(), a.data(), size, b), static_cast<uint64_t>(current));
+            EXPECT_EQ(result, expected);
+        }
+    }
+}
+
+TEST(LimbsTest, TestChainedDivision) {
+    std::mt19937_64 rng(24);
+    const big_int_impl::limb_divisor divisor(10000000000000000000ull);
+    for (const int size : {1, 3, 8, 33}) {
+        const auto a = get_limbs_test_value(rng, size);
+        for (const int count : {1, 2, 4}) {
+            std::vector<uint64_t> result(size), rems(count);
+            big_int_impl::limbs_div_1_chained(result.data(), a.data(), size, divisor, rems.data(), count);
+
+            std::vector<uint64_t> expected = a;
+            for (int j = 0; j < count; j++) {
+                EXPECT_EQ(big_int_impl::limbs_div_1(expected.data(), expected.data(), size, divisor), rems[j]);
+            }
+            EXPECT_EQ(result, expected);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/newton_division.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+
+namespace {
+    void set_newton_threshold(const int newton_division) {
+        big_int::thresholds_t thresholds;
+        thresholds.burnikel_ziegler = 4;
+        thresholds.newton_division = newton_division;
+        big_int::set_thresholds(thresholds);
+    }
+}
+
+TEST(NewtonDivisionTest, TestReciprocalError) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(5);
+    set_newton_threshold(5);
+    for (const int n : {5, 6, 13, 40, 77, 300}) {
+        for (int it = 0; it < 5; it++) {
+            auto b = random_test_value(rng, n);
+            if (it == 0) b.data.assign(n, ~0ull);
+            if (it == 1) b.data.assign(n, 0), b.data.back() = 1ull << 63;
+            b.data.back() |= 1ull << 63;
+
+            const auto x = newton_reciprocal(b);
+            bint_t exact;
+            exact.data.resize(2 * n + 1);
+            exact.data[2 * n] = 1;
+            exact -= x * b;
+            // |2^(128 n) - x b| < 8 b
+            EXPECT_TRUE(big_int_impl::compare_abs(exact, b * bint_t(8)) < 0) << "n = " << n << ", it = " << it;
+        }
+    }
+}
+
+TEST(NewtonDivisionTest, TestAgainstBurnikelZiegler) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(6);
+    for (const auto& [a_size, b_size] : {std::pair{10, 5}, {11, 10}, {64, 20}, {157, 50}, {1000, 120}, {600, 300}, {301, 300}}) {
+        for (int it = 0; it < 4; it++) {
+            auto a = random_test_value(rng, a_size);
+            auto b = random_test_value(rng, b_size);
+            if (it == 1) b.data.back() = 1;
+            if (it == 2) a = b * random_test_value(rng, a_size - b_size);
+            if (it == 3) b.data.back() |= 1ull << 63;
+
+            guard.restore();
+            auto expected = a;
+            bint_t expected_rem;
+            big_int::divide_abs(expected, b, expected_rem);
+
+            set_newton_threshold(5);
+            auto quotient = a;
+            bint_t rem;
+            big_int::divide_abs(quotient, b, rem);
+            EXPECT_EQ(quotient, expected) << a_size << " / " << b_size << ", it = " << it;
+            EXPECT_EQ(rem, expected_rem) << a_size << " / " << b_size << ", it = " << it;
+        }
+    }
+}
+
+TEST(NewtonDivisionTest, TestWrappedProducts) {
+    // Small NTT threshold makes the remainders computed from products modulo 2^(64 n) - 1
+    const thresholds_guard guard;
+    std::mt19937_64 rng(7);
+    big_int::thresholds_t thresholds;
+    thresholds.burnikel_ziegler = 4;
+    thresholds.newton_division = 20;
+    thresholds.ntt = thresholds.ntt_square = 16;
+    for (const auto& [a_size, b_size] : {std::pair{250, 120}, {260, 126}, {1000, 61}, {130, 65}}) {
+        const auto a = random_test_value(rng, a_size);
+        const auto b = random_test_value(rng, b_size);
+        guard.restore();
+        const auto expected_quotient = a / b;
+        const auto expected_rem = a % b;
+
+        big_int::set_thresholds(thresholds);
+        EXPECT_EQ(a / b, expected_quotient) << a_size << " / " << b_size;
+        EXPECT_EQ(a % b, expected_rem) << a_size << " / " << b_size;
+    }
+}
+
+TEST(NewtonDivisionTest, TestSignedOperators) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(8);
+    set_newton_threshold(5);
+    const auto a = random_test_value(rng, 50);
+    const auto b = random_test_value(rng, 20);
+    for (const bool a_sign : {false, true}) {
+        for (const bool b_sign : {false, true}) {
+            const auto x = a_sign ? -a : a;
+            const auto y = b_sign ? -b : b;
+            const auto q = x / y;
+            const auto r = x % y;
+            EXPECT_EQ(q * y + r, x);
+            EXPECT_TRUE(big_int_impl::compare_abs(r, y) < 0);
+            EXPECT_TRUE(r == bint_t(0) || r.sign == y.sign);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/ntt.h>
+#include "test_values.h"
+
+#include <random>
+#include <tuple>
+
+TEST(NttTest, TestMultiplyMatchesSchoolbook) {
+    std::mt19937_64 rng(42);
+    for (const auto& [n, m] : {std::pair(1, 1), std::pair(7, 300), std::pair(513, 511), std::pair(1000, 1024)}) {
+        const auto a = random_test_value(rng, n);
+        const auto b = random_test_value(rng, m);
+        EXPECT_EQ(ntt_multiply(a, b), big_int_impl::schoolbook_multiply(a, b));
+    }
+}
+
+TEST(NttTest, TestSquareAllOnes) {
+    // (2^(64n) - 1)^2 produces the maximal coefficients of the convolution
+    bint_t a;
+    a.data.assign(2000, static_cast<uint64_t>(-1));
+    auto square = a;
+    ntt_square(square);
+    EXPECT_EQ(square, big_int_impl::schoolbook_multiply(a, a));
+}
+
+TEST(NttTest, TestSigns) {
+    std::mt19937_64 rng(7);
+    auto a = random_test_value(rng, 100);
+    const auto b = random_test_value(rng, 50);
+    a.sign = true;
+    EXPECT_EQ(ntt_multiply(a, b), big_int_impl::schoolbook_multiply(a, b));
+    EXPECT_TRUE(ntt_multiply(a, b).sign);
+}
+
+TEST(NttTest, TestPowThroughDispatch) {
+    bint_t a(3);
+    bint_t b(3);
+    big_int::fast_pow_inplace(a, 1000000);
+    big_int::fast_pow_inplace(b, 600000);
+    bint_t expected(3);
+    big_int::fast_pow_inplace(expected, 1600000);
+    EXPECT_EQ(a * b, expected);
+}
+
+TEST(NttTest, TestMultiplyWrapped) {
+    std::mt19937_64 rng(43);
+    for (const auto& [n, m, wrap] : {std::tuple(3, 4, 4), std::tuple(100, 60, 128), std::tuple(512, 512, 512), std::tuple(700, 1024, 1024)}) {
+        const auto a = random_test_value(rng, n);
+        const auto b = random_test_value(rng, m);
+        bint_t modulus;
+        modulus.data.assign(wrap, static_cast<uint64_t>(-1));
+        EXPECT_EQ(ntt_multiply_wrapped(a, b, wrap) % modulus, a * b % modulus);
+    }
+
+    // (2^(64n) - 1)^2 is divisible by the modulus
+    bint_t ones;
+    ones.data.assign(256, static_cast<uint64_t>(-1));
+    const auto wrapped = ntt_multiply_wrapped(ones, ones, 256);
+    EXPECT_TRUE(wrapped == bint_t(0) || wrapped == ones);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include "test_values.h"
+
+#include <random>
+#include <utility>
+
+TEST(OperatorsTest, TestInplaceAddSub) {
+    std::mt19937_64 random(11);
+    for (const int a_size : {0, 1, 3, 6, 50}) {
+        for (const int b_size : {0, 1, 3, 6, 50}) {
+            for (int it = 0; it < 8; it++) {
+                const bint_t a = random_signed_test_value(random, a_size);
+                const bint_t b = random_signed_test_value(random, b_size);
+                const bint_t sum = big_int::add(a, b);
+                const bint_t difference = big_int::sub(a, b);
+                EXPECT_EQ(sum - b, a);
+                EXPECT_EQ(difference + b, a);
+
+                bint_t c = a;
+                c += b;
+                EXPECT_EQ(c, sum);
+                c -= b;
+                EXPECT_EQ(c, a);
+                c -= a;
+                EXPECT_EQ(c, bint_t(0));
+                EXPECT_FALSE(c.sign);
+            }
+        }
+    }
+}
+
+TEST(OperatorsTest, TestRvalueOperators) {
+    std::mt19937_64 random(12);
+    for (int it = 0; it < 50; it++) {
+        const bint_t a = random_signed_test_value(random, 1 + random() % 8);
+        const bint_t b = random_signed_test_value(random, 1 + random() % 8);
+        const bint_t sum = a + b;
+        const bint_t difference = a - b;
+        const bint_t product = a * b;
+
+        EXPECT_EQ(bint_t(a) + b, sum);
+        EXPECT_EQ(a + bint_t(b), sum);
+        EXPECT_EQ(bint_t(a) + bint_t(b), sum);
+        EXPECT_EQ(bint_t(a) - b, difference);
+        EXPECT_EQ(a - bint_t(b), difference);
+        EXPECT_EQ(bint_t(a) - bint_t(b), difference);
+        EXPECT_EQ(-bint_t(a), bint_t(0) - a);
+        EXPECT_EQ(bint_t(a) * b, product);
+        EXPECT_EQ(a * bint_t(b), product);
+        EXPECT_EQ(bint_t(a) * bint_t(b), product);
+        EXPECT_EQ(bint_t(product) / b, a);
+        EXPECT_EQ(bint_t(a) % b, a % b);
+        EXPECT_EQ(bint_t(a) << 100, a << 100);
+        EXPECT_EQ(bint_t(a) >> 70, a >> 70);
+    }
+}
+
+TEST(OperatorsTest, TestSelfOperands) {
+    std::mt19937_64 random(13);
+    const bint_t a = random_signed_test_value(random, 5);
+
+    bint_t b = a;
+    b += b;
+    EXPECT_EQ(b, a * bint_t(2));
+    b -= b;
+    EXPECT_EQ(b, bint_t(0));
+    EXPECT_FALSE(b.sign);
+
+    // The rvalue operand is the same object as the lvalue one
+    b = a;
+    EXPECT_EQ(b - std::move(b), bint_t(0));
+    b = a;
+    EXPECT_EQ(b + std::move(b), a * bint_t(2));
+    b = a;
+    EXPECT_EQ(b * std::move(b), a * a);
+
+    b = a;
+    b *= bint_t(-3);
+    EXPECT_EQ(b, -(a + a + a));
+    b *= bint_t(0);
+    EXPECT_EQ(b, bint_t(0));
+    EXPECT_FALSE(b.sign);
+}
+
+TEST(OperatorsTest, TestStorageReuse) {
+    bint_t a(1);
+    a <<= 64 * 100;
+    a.data.reserve(200);
+    const uint64_t* storage = a.data.data();
+
+    const bint_t b(12345);
+    bint_t sum = std::move(a) + b;
+    EXPECT_EQ(sum.data.data(), storage);
+    sum = b - std::move(sum);
+    EXPECT_EQ(sum.data.data(), storage);
+    sum *= bint_t(1000);
+    EXPECT_EQ(sum.data.data(), storage);
+    sum += bint_t(7);
+    EXPECT_EQ(sum.data.data(), storage);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/conversion_cache.h>
+#include <big_int/karatsuba.h>
+#include <big_int/ntt.h>
+#include <big_int/thread_pool.h>
+#include <big_int/toom_cook.h>
+#include "test_values.h"
+
+#include <random>
+#include <thread>
+
+class ParallelTest : public testing::Test {
+protected:
+    void SetUp() override {
+        big_int::set_thread_count(4);
+        big_int::set_parallel_threshold(100);
+    }
+
+    void TearDown() override {
+        big_int::set_thread_count(1);
+        big_int::set_parallel_threshold(1000);
+    }
+};
+
+TEST_F(ParallelTest, TestParallelProductsMatchSchoolbook) {
+    std::mt19937_64 rng(5);
+    for (const int n : {150, 1000, 3001}) {
+        const auto a = random_test_value(rng, n);
+        const auto b = random_test_value(rng, n);
+        const auto expected = big_int_impl::schoolbook_multiply(a, b);
+        EXPECT_EQ(karatsuba(a, b), expected);
+        EXPECT_EQ(toom3(a, b), expected);
+        EXPECT_EQ(toom4(a, b), expected);
+        EXPECT_EQ(toom6h(a, b), expected);
+        EXPECT_EQ(ntt_multiply(a, b), expected);
+    }
+}
+
+TEST_F(ParallelTest, TestParallelSquaresMatchSchoolbook) {
+    std::mt19937_64 rng(55);
+    for (const int n : {150, 2500}) {
+        const auto a = random_test_value(rng, n);
+        const auto expected = big_int_impl::schoolbook_multiply(a, a);
+        auto square2 = a;
+        karatsuba_square(square2);
+        auto square3 = a;
+        toom3_square(square3);
+        auto square4 = a;
+        toom4_square(square4);
+        auto square6 = a;
+        toom6h_square(square6);
+        EXPECT_EQ(square2, expected);
+        EXPECT_EQ(square3, expected);
+        EXPECT_EQ(square4, expected);
+        EXPECT_EQ(square6, expected);
+    }
+}
+
+TEST_F(ParallelTest, TestConcurrentCallers) {
+    std::mt19937_64 rng(555);
+    const auto a = random_test_value(rng, 2000);
+    const auto b = random_test_value(rng, 2000);
+    const auto expected = big_int_impl::schoolbook_multiply(a, b);
+
+    std::vector<bint_t> results(4);
+    std::vector<std::thread> callers;
+    for (auto& result : results) {
+        callers.emplace_back([&] { result = toom3(a, b); });
+    }
+    for (auto& caller : callers) caller.join();
+    for (const auto& result : results) EXPECT_EQ(result, expected);
+}
+
+TEST_F(ParallelTest, TestParallelToString) {
+    std::mt19937_64 rng(8);
+    for (const int n : {99, 100, 1000, 5000}) {
+        auto a = random_test_value(rng, n);
+        a.sign = n % 2 == 0;
+        const auto parallel = a.to_string();
+
+        big_int::set_thread_count(1);
+        EXPECT_EQ(parallel, a.to_string()) << "n = " << n;
+        big_int::set_thread_count(4);
+    }
+}
+
+TEST_F(ParallelTest, TestParallelFromString) {
+    std::mt19937_64 rng(9);
+    for (const int n : {150, 1000, 5000}) {
+        auto a = random_test_value(rng, n);
+        a.sign = n % 2 == 0;
+        EXPECT_EQ(bint_t::from_string(a.to_string()), a) << "n = " << n;
+    }
+}
+
+TEST_F(ParallelTest, TestConcurrentConversions) {
+    std::mt19937_64 rng(21);
+    std::vector<bint_t> values;
+    std::vector<std::string> expected;
+    for (const int radix : {10, 7, 10, 36}) {
+        values.push_back(random_test_value(rng, 1500));
+        expected.push_back(values.back().to_string(radix));
+    }
+
+    // Callers share the cached powers, one more thread keeps evicting them
+    big_int::clear_conversion_cache();
+    std::atomic<bool> done = false;
+    std::thread evictor([&] {
+        while (!done.load()) big_int::clear_conversion_cache();
+    });
+    std::vector<std::string> strings(values.size());
+    std::vector<bint_t> parsed(values.size());
+    std::vector<std::thread> callers;
+    for (int i = 0; i < values.size(); i++) {
+        callers.emplace_back([&, i] {
+            const int radix = i == 1 ? 7 : i == 3 ? 36 : 10;
+            strings[i] = values[i].to_string(radix);
+            parsed[i] = bint_t::from_string(expected[i], radix);
+        });
+    }
+    for (auto& caller : callers) caller.join();
+    done = true;
+    evictor.join();
+
+    for (int i = 0; i < values.size(); i++) {
+        EXPECT_EQ(strings[i], expected[i]);
+        EXPECT_EQ(parsed[i], values[i]);
+    }
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+#include <stdexcept>
+
+namespace {
+    bint_t square_and_reduce_pow(const bint_t& base, const bint_t& exp, const bint_t& mod) {
+        bint_t result(1);
+        const bint_t reduced_base = base % mod;
+        for (int i = static_cast<int>(big_int_impl::count_bits(exp)) - 1; i >= 0; i--) {
+            result = result * result % mod;
+            if (exp.data[i / 64] >> i % 64 & 1) result = result * reduced_base % mod;
+        }
+        return result % mod;
+    }
+}
+
+TEST(PowmodTest, TestFermatLittleTheorem) {
+    // 2^127 - 1 and 2^521 - 1 are prime
+    for (const int p : {127, 521}) {
+        const bint_t prime = (bint_t(1) << p) - bint_t(1);
+        for (const int a : {2, 3, 12345}) {
+            EXPECT_EQ(big_int::powmod(bint_t(a), prime - bint_t(1), prime), bint_t(1)) << "p = " << p << ", a = " << a;
+        }
+    }
+    // 561 = 3 * 11 * 17 is a Carmichael number, but the witness 3 is not coprime to it
+    EXPECT_NE(big_int::powmod(bint_t(3), bint_t(560), bint_t(561)), bint_t(1));
+}
+
+TEST(PowmodTest, TestMatchesSquareAndReduce) {
+    std::mt19937_64 rng(15);
+    for (const int mod_size : {1, 2, 5, 16, 33}) {
+        for (int it = 0; it < 8; it++) {
+            auto mod = random_test_value(rng, mod_size);
+            if (it % 2 == 1) mod.data[0] &= ~1ull;
+            auto base = random_test_value(rng, 1 + it * mod_size / 3);
+            base.sign = it % 3 == 0;
+            const auto exp = random_test_value(rng, 1 + it % 3);
+            EXPECT_EQ(big_int::powmod(base, exp, mod), square_and_reduce_pow(base, exp, mod))
+                << "mod_size = " << mod_size << ", it = " << it;
+        }
+    }
+}
+
+TEST(PowmodTest, TestReductionWithMultiplications) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(16);
+    big_int::thresholds_t thresholds;
+    thresholds.toom_cook = thresholds.toom_cook_square = 8;
+    big_int::set_thresholds(thresholds);
+    for (const int mod_size : {8, 13, 40}) {
+        auto mod = random_test_value(rng, mod_size);
+        const auto base = random_test_value(rng, mod_size + 3);
+        const auto exp = random_test_value(rng, 2);
+        EXPECT_EQ(big_int::powmod(base, exp, mod), square_and_reduce_pow(base, exp, mod)) << "mod_size = " << mod_size;
+    }
+}
+
+TEST(PowmodTest, TestEdgeCases) {
+    EXPECT_EQ(big_int::powmod(bint_t(5), bint_t(0), bint_t(7)), bint_t(1));
+    EXPECT_EQ(big_int::powmod(bint_t(5), bint_t(0), bint_t(1)), bint_t(0));
+    EXPECT_EQ(big_int::powmod(bint_t(0), bint_t(3), bint_t(7)), bint_t(0));
+    EXPECT_EQ(big_int::powmod(bint_t(-2), bint_t(3), bint_t(7)), bint_t(6));
+    EXPECT_EQ(big_int::powmod(bint_t(3), bint_t(4), bint_t(10)), bint_t(1));
+    EXPECT_THROW(big_int::powmod(bint_t(3), bint_t(4), bint_t(0)), std::invalid_argument);
+    EXPECT_THROW(big_int::powmod(bint_t(3), bint_t(4), bint_t(-5)), std::invalid_argument);
+    EXPECT_THROW(big_int::powmod(bint_t(3), bint_t(-4), bint_t(5)), std::invalid_argument);
+}
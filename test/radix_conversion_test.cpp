@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    std::string naive_to_string(bint_t a, const int radix) {
+        std::string result;
+        a.sign = false;
+        const bint_t zero(0), base(radix);
+        while (a != zero) {
+            const bint_t digit = a % base;
+            result.push_back("0123456789abcdefghijklmnopqrstuvwxyz"[digit.data[0]]);
+            a /= base;
+        }
+        if (result.empty()) result = "0";
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+}
+
+TEST(RadixConversionTest, TestSmallValues) {
+    EXPECT_EQ(bint_t(0).to_string(16), "0");
+    EXPECT_EQ(bint_t(0).to_string(7), "0");
+    EXPECT_EQ(bint_t(255).to_string(16), "ff");
+    EXPECT_EQ(bint_t(-255).to_string(2), "-11111111");
+    EXPECT_EQ(bint_t(8).to_string(8), "10");
+    EXPECT_EQ(bint_t(35).to_string(36), "z");
+    EXPECT_EQ(bint_t(UINT64_MAX).to_string(16), std::string(16, 'f'));
+    EXPECT_EQ((bint_t(1) << 64).to_string(16), "1" + std::string(16, '0'));
+    EXPECT_EQ((bint_t(1) << 65).to_string(32), "1" + std::string(13, '0'));
+
+    EXPECT_EQ(bint_t::from_string("DEADbeef", 16), bint_t(0xdeadbeefull));
+    EXPECT_EQ(bint_t::from_string("-zz", 36), bint_t(-1295));
+    EXPECT_EQ(bint_t::from_string("0000000000000000000000ffffffffffffffff", 16), bint_t(UINT64_MAX));
+    EXPECT_EQ(bint_t::from_string("-0", 2), bint_t(0));
+    EXPECT_FALSE(bint_t::from_string("-0", 2).sign);
+}
+
+TEST(RadixConversionTest, TestAgainstNaive) {
+    std::mt19937_64 rng(20);
+    for (int radix = 2; radix <= 36; radix++) {
+        for (const int size : {1, 2, 3, 10}) {
+            auto a = random_test_value(rng, size);
+            a.sign = size % 2 == 0;
+            const std::string expected = (a.sign ? "-" : "") + naive_to_string(a, radix);
+            EXPECT_EQ(a.to_string(radix), expected) << "radix = " << radix << ", size = " << size;
+            EXPECT_EQ(bint_t::from_string(expected, radix), a) << "radix = " << radix << ", size = " << size;
+        }
+    }
+}
+
+TEST(RadixConversionTest, TestDecimalDigitPatterns) {
+    // Zeroes and nines in every digit position of the 19-digit groups and of their 8-digit halves
+    for (int length = 1; length <= 60; length++) {
+        for (const char fill : {'0', '9'}) {
+            for (int position = 0; position < length; position++) {
+                std::string str(length, fill);
+                str[0] = '1';
+                str[position] = static_cast<char>(fill == '0' ? '9' : '1');
+                const auto a = bint_t::from_string(str);
+                EXPECT_EQ(a.to_string(), str);
+                EXPECT_EQ(a.to_string(), naive_to_string(a, 10));
+            }
+        }
+    }
+}
+
+TEST(RadixConversionTest, TestRoundTrip) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(21);
+    big_int::thresholds_t thresholds;
+    thresholds.to_string = 2;
+    thresholds.from_string = 2;
+    big_int::set_thresholds(thresholds);
+    for (const int radix : {2, 3, 7, 8, 10, 16, 32, 36}) {
+        for (const int size : {5, 64, 333}) {
+            const auto a = random_test_value(rng, size);
+            const auto str = a.to_string(radix);
+            EXPECT_NE(str[0], '0');
+            EXPECT_EQ(bint_t::from_string(str, radix), a) << "radix = " << radix << ", size = " << size;
+        }
+    }
+}
+
+TEST(RadixConversionTest, TestInvalidInput) {
+    EXPECT_THROW(bint_t(1).to_string(1), std::invalid_argument);
+    EXPECT_THROW(bint_t(1).to_string(37), std::invalid_argument);
+    EXPECT_THROW(bint_t::from_string("1", 0), std::invalid_argument);
+    EXPECT_THROW(bint_t::from_string("12", 2), std::invalid_argument);
+    EXPECT_THROW(bint_t::from_string("0x1f", 16), std::invalid_argument);
+    EXPECT_THROW(bint_t::from_string("g", 16), std::invalid_argument);
+
+    const std::string str = "1012";
+    bint_t value;
+    const auto [end, error] = bint_t::from_chars(str.data(), str.data() + str.size(), value, 2);
+    EXPECT_EQ(error, std::errc());
+    EXPECT_EQ(end, str.data() + 3);
+    EXPECT_EQ(value, bint_t(5));
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/serialization.h>
+#include "test_values.h"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    std::string serialization_test_path(const std::string& name) {
+        return testing::TempDir() + "big_int_serialization_" + name + ".bin";
+    }
+}
+
+TEST(SerializationTest, TestStreamRoundTrip) {
+    std::mt19937_64 rng(23);
+    for (const auto& a : {bint_t(0), bint_t(-1), bint_t(UINT64_MAX),
+                          random_test_value(rng, 100), -random_test_value(rng, 1000)}) {
+        std::stringstream stream;
+        big_int::write_binary(stream, a);
+        EXPECT_EQ(stream.str().size(), 16 + 8 * a.data.size());
+        EXPECT_EQ(stream.str().substr(0, 4), "BINT");
+        const auto b = big_int::read_binary(stream);
+        EXPECT_EQ(b, a);
+        EXPECT_EQ(b.sign, a.sign);
+    }
+}
+
+TEST(SerializationTest, TestInvalidInput) {
+    std::stringstream stream;
+    big_int::write_binary(stream, bint_t(12345) << 100);
+    const std::string valid = stream.str();
+
+    const auto read = [](const std::string& bytes) {
+        std::istringstream input(bytes);
+        return big_int::read_binary(input);
+    };
+    EXPECT_EQ(read(valid), bint_t(12345) << 100);
+    EXPECT_THROW(read(valid.substr(0, 10)), std::runtime_error);
+    EXPECT_THROW(read(valid.substr(0, valid.size() - 1)), std::runtime_error);
+    EXPECT_THROW(read("TNIB" + valid.substr(4)), std::runtime_error);
+
+    std::string future_version = valid;
+    future_version[4] = 2;
+    EXPECT_THROW(read(future_version), std::runtime_error);
+
+    // The highest limb is zero
+    std::string not_normalized = valid;
+    std::fill(not_normalized.end() - 8, not_normalized.end(), '\0');
+    EXPECT_THROW(read(not_normalized), std::runtime_error);
+}
+
+TEST(SerializationTest, TestFiles) {
+    std::mt19937_64 rng(24);
+    const auto a = -random_test_value(rng, 3000);
+    const auto b = random_test_value(rng, 1500);
+    const auto path = serialization_test_path("files");
+    big_int::save_binary(path, a);
+    EXPECT_EQ(big_int::load_binary(path), a);
+
+    {
+        bint_mapped_file mapped(path);
+        const bint_t& view = mapped.value();
+        EXPECT_TRUE(view.data.is_borrowed());
+        EXPECT_EQ(view, a);
+
+        // The view is an ordinary operand, its copies own their limbs
+        EXPECT_EQ(view * b, a * b);
+        auto quotient = view;
+        bint_t rem;
+        big_int::divide_abs(quotient, b, rem);
+        auto expected_quotient = a;
+        bint_t expected_rem;
+        big_int::divide_abs(expected_quotient, b, expected_rem);
+        EXPECT_FALSE(quotient.data.is_borrowed());
+        EXPECT_EQ(quotient, expected_quotient);
+        EXPECT_EQ(rem, expected_rem);
+        EXPECT_EQ(view.to_string(), a.to_string());
+
+        const bint_mapped_file moved(std::move(mapped));
+        EXPECT_EQ(moved.value(), a);
+    }
+
+    {
+        std::ofstream truncated(path, std::ios::binary | std::ios::trunc);
+        truncated << "BINT";
+    }
+    EXPECT_THROW(bint_mapped_file mapped(path), std::runtime_error);
+    EXPECT_THROW(big_int::load_binary(path), std::runtime_error);
+    EXPECT_THROW(bint_mapped_file mapped(serialization_test_path("missing")), std::runtime_error);
+    std::remove(path.c_str());
+}
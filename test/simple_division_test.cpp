@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <big_int/big_int.h>
 #include <big_int/big_int_ops.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
 
 std::pair<bint_t, bint_t> get_test_div_values(const bool first_sign, const bool second_sign) {
     bint_t a(3);
@@ -75,4 +79,44 @@ TEST(SimpleDivisionTest, TestNegNegAssign) {
     c /= b;
     EXPECT_EQ(a, bint_t(-621272702107522001ll));
     EXPECT_STREQ(c.to_string().c_str(), "515377520732011331036461129765");
-}
\ No newline at end of file
+}
+
+TEST(SimpleDivisionTest, TestDivmod) {
+    for (int signs = 0; signs < 4; signs++) {
+        auto [a, b] = get_test_div_values(signs & 1, signs & 2);
+        const auto [div, mod] = big_int::divmod(a, b);
+        EXPECT_EQ(div, a / b);
+        EXPECT_EQ(mod, a % b);
+    }
+    const auto [div, mod] = big_int::divmod(bint_t(-6), bint_t(3));
+    EXPECT_EQ(div, bint_t(-2));
+    EXPECT_EQ(mod, bint_t(0));
+}
+
+TEST(SimpleDivisionTest, TestDivisionOutputs) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(17);
+
+    // Knuth, Burnikel-Ziegler and Newton divisions
+    big_int::thresholds_t thresholds;
+    thresholds.burnikel_ziegler = 4;
+    thresholds.newton_division = 30;
+    big_int::set_thresholds(thresholds);
+    for (const auto& [a_size, b_size] : {std::pair{3, 2}, {2, 3}, {20, 7}, {50, 12}, {100, 40}, {70, 35}}) {
+        const auto a = random_test_value(rng, a_size);
+        const auto b = random_test_value(rng, b_size);
+        auto expected = a;
+        bint_t expected_rem;
+        big_int::divide_abs(expected, b, expected_rem);
+
+        auto quotient = a;
+        bint_t rem;
+        big_int::divide_abs(quotient, b, rem, big_int::division_output::quotient);
+        EXPECT_EQ(quotient, expected) << "a_size = " << a_size << ", b_size = " << b_size;
+
+        auto dividend = a;
+        big_int::divide_abs(dividend, b, rem, big_int::division_output::remainder);
+        EXPECT_EQ(rem, expected_rem) << "a_size = " << a_size << ", b_size = " << b_size;
+        EXPECT_EQ(expected * b + expected_rem, a);
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#ifndef TEST_VALUES_H
+#define TEST_VALUES_H
+
+#include <big_int/big_int.h>
+#include <big_int/thresholds.h>
+
+#include <random>
+
+/**
+ * Random value of exactly `size > 0` limbs, the highest limb is made odd to be non-zero
+ */
+inline bint_t random_test_value(std::mt19937_64& rng, const int size, const bool negative = false) {
+    bint_t a;
+    a.data.resize(size);
+    for (auto& limb : a.data) limb = rng();
+    a.data.back() |= 1;
+    a.sign = negative;
+    return a;
+}
+
+/**
+ * Random value of at most `limbs` limbs with a random sign, zero for `limbs == 0`
+ */
+inline bint_t random_signed_test_value(std::mt19937_64& rng, const int limbs) {
+    bint_t result(0);
+    for (int i = 0; i < limbs; i++) {
+        result = (result << 64) + bint_t(rng());
+    }
+    return rng() % 2 == 0 ? result : -result;
+}
+
+/**
+ * Saves the current thresholds and restores them on destruction, so a test can override them freely
+ */
+class thresholds_guard {
+public:
+    thresholds_guard() : saved(big_int::get_thresholds()) {}
+    ~thresholds_guard() { restore(); }
+
+    thresholds_guard(const thresholds_guard&) = delete;
+    thresholds_guard& operator=(const thresholds_guard&) = delete;
+
+    void restore() const { big_int::set_thresholds(saved); }
+
+private:
+    const big_int::thresholds_t saved;
+};
+
+#endif //TEST_VALUES_H
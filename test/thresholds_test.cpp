@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/thresholds.h>
+#include "test_values.h"
+
+#include <random>
+#include <sstream>
+
+TEST(ThresholdsTest, TestWriteReadRoundTrip) {
+    big_int::thresholds_t thresholds;
+    thresholds.karatsuba = 33;
+    thresholds.toom_cook_square = 444;
+    thresholds.toom_42_ratio = 2.25;
+
+    std::stringstream stream;
+    big_int::write_thresholds(stream, thresholds);
+    const auto result = big_int::read_thresholds(stream);
+    EXPECT_EQ(result.karatsuba, 33);
+    EXPECT_EQ(result.toom_cook_square, 444);
+    EXPECT_EQ(result.toom_42_ratio, 2.25);
+    EXPECT_EQ(result.ntt, thresholds.ntt);
+}
+
+TEST(ThresholdsTest, TestReadKeepsMissingValues) {
+    std::istringstream stream("# tuned values\n\nntt = 12345  # comment\n  to_string=7\n");
+    EXPECT_THROW(big_int::read_thresholds(stream), std::runtime_error);
+
+    std::istringstream valid("# tuned values\n\nntt = 12345  # comment\n  to_string = 7\n");
+    const auto result = big_int::read_thresholds(valid);
+    EXPECT_EQ(result.ntt, 12345);
+    EXPECT_EQ(result.to_string, 7);
+    EXPECT_EQ(result.karatsuba, big_int::thresholds_t{}.karatsuba);
+
+    std::istringstream unknown("toom_5 = 100\n");
+    EXPECT_THROW(big_int::read_thresholds(unknown), std::runtime_error);
+}
+
+TEST(ThresholdsTest, TestInvalidThresholds) {
+    big_int::thresholds_t thresholds;
+    thresholds.karatsuba = 1;
+    EXPECT_THROW(big_int::set_thresholds(thresholds), std::invalid_argument);
+    EXPECT_EQ(big_int::get_thresholds().karatsuba, big_int::thresholds_t{}.karatsuba);
+
+    // Slicing an operand into a single slice never terminates
+    thresholds = {};
+    thresholds.unbalanced_slice_ratio = 1;
+    EXPECT_THROW(big_int::set_thresholds(thresholds), std::invalid_argument);
+    std::istringstream file("unbalanced_slice_ratio = 1.5\n");
+    EXPECT_THROW(big_int::set_thresholds(big_int::read_thresholds(file)), std::invalid_argument);
+}
+
+TEST(ThresholdsTest, TestSmallestThresholds) {
+    const thresholds_guard guard;
+    std::mt19937_64 rng(7);
+    const auto value = random_test_value(rng, 30);
+    big_int::thresholds_t thresholds;
+    thresholds.to_string = 1000;
+    big_int::set_thresholds(thresholds);
+    const auto expected = value.to_string();
+
+    thresholds.karatsuba = thresholds.karatsuba_square = 2;
+    thresholds.toom_cook = thresholds.toom_cook_square = 5;
+    thresholds.toom_4 = thresholds.toom_4_square = 40;
+    thresholds.toom_6h = thresholds.toom_6h_square = 80;
+    thresholds.ntt = thresholds.ntt_square = 300;
+    thresholds.burnikel_ziegler = 2;
+    thresholds.to_string = 2;
+    big_int::set_thresholds(thresholds);
+
+    for (const int n : {3, 17, 60, 150, 400}) {
+        const auto a = random_test_value(rng, n);
+        const auto b = random_test_value(rng, n + 3);
+        const auto product = big_int::multiply(a, b);
+        EXPECT_EQ(product, big_int_impl::schoolbook_multiply(a, b));
+
+        auto square = a;
+        big_int_impl::square(square);
+        EXPECT_EQ(square, big_int_impl::schoolbook_multiply(a, a));
+
+        bint_t quotient = product;
+        bint_t rem;
+        big_int::divide_abs(quotient, a, rem);
+        EXPECT_EQ(quotient, b);
+        EXPECT_EQ(rem, bint_t(0));
+    }
+
+    EXPECT_EQ(value.to_string(), expected);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/thresholds.h>
+#include <big_int/toom_cook.h>
+#include "test_values.h"
+
+#include <random>
+
+TEST(ToomCookTest, TestToom4MatchesSchoolbook) {
+    std::mt19937_64 rng(4);
+    for (const auto& [n, m] : {std::pair(4, 4), std::pair(400, 400), std::pair(401, 150), std::pair(37, 399)}) {
+        const auto a = random_test_value(rng, n, true);
+        const auto b = random_test_value(rng, m);
+        EXPECT_EQ(toom4(a, b), big_int_impl::schoolbook_multiply(a, b));
+    }
+}
+
+TEST(ToomCookTest, TestToom6hMatchesSchoolbook) {
+    std::mt19937_64 rng(6);
+    for (const auto& [n, m] : {std::pair(7, 6), std::pair(600, 600), std::pair(700, 600), std::pair(350, 699)}) {
+        const auto a = random_test_value(rng, n);
+        const auto b = random_test_value(rng, m, true);
+        EXPECT_EQ(toom6h(a, b), big_int_impl::schoolbook_multiply(a, b));
+    }
+}
+
+TEST(ToomCookTest, TestSquares) {
+    std::mt19937_64 rng(8);
+    for (const int n : {12, 500, 777}) {
+        const auto a = random_test_value(rng, n);
+        const auto expected = big_int_impl::schoolbook_multiply(a, a);
+        auto square4 = a;
+        toom4_square(square4);
+        EXPECT_EQ(square4, expected);
+        auto square6 = a;
+        toom6h_square(square6);
+        EXPECT_EQ(square6, expected);
+    }
+}
+
+TEST(ToomCookTest, TestAllOnesToom4) {
+    bint_t a;
+    a.data.assign(1000, static_cast<uint64_t>(-1));
+    EXPECT_EQ(toom4(a, a), big_int_impl::schoolbook_multiply(a, a));
+}
+
+TEST(ToomCookTest, TestAllOnesToom6h) {
+    bint_t a;
+    a.data.assign(1200, static_cast<uint64_t>(-1));
+    const auto expected = big_int_impl::schoolbook_multiply(a, a);
+    EXPECT_EQ(toom6h(a, a), expected);
+    toom6h_square(a);
+    EXPECT_EQ(a, expected);
+}
+
+TEST(ToomCookTest, TestUnbalancedToomMatchesSchoolbook) {
+    std::mt19937_64 rng(32);
+    for (const auto& [n, m] : {std::pair(3, 2), std::pair(300, 200), std::pair(400, 200), std::pair(150, 399)}) {
+        const auto a = random_test_value(rng, n, true);
+        const auto b = random_test_value(rng, m);
+        const auto expected = big_int_impl::schoolbook_multiply(a, b);
+        EXPECT_EQ(toom32(a, b), expected);
+        EXPECT_EQ(toom42(a, b), expected);
+    }
+}
+
+TEST(ToomCookTest, TestMultiplyUnbalanced) {
+    std::mt19937_64 rng(100);
+    const auto a = random_test_value(rng, 5000);
+    const auto b = random_test_value(rng, 120, true);
+    const auto expected = big_int_impl::schoolbook_multiply(a, b);
+    EXPECT_EQ(big_int_impl::multiply_unbalanced(a, b), expected);
+    EXPECT_EQ(big_int::multiply(b, a), expected);
+    // Operands of close sizes are not sliced
+    EXPECT_EQ(big_int_impl::multiply_unbalanced(b, b), big_int_impl::schoolbook_multiply(b, b));
+}
+
+TEST(ToomCookTest, TestToomRecursion) {
+    // Toom-4 and Toom-6.5 call each other in the recursion on all sizes starting from their minimal thresholds
+    const thresholds_guard guard;
+    std::mt19937_64 rng(46);
+    big_int::thresholds_t thresholds;
+    thresholds.karatsuba = thresholds.karatsuba_square = 4;
+    thresholds.toom_cook = thresholds.toom_cook_square = 6;
+    thresholds.toom_4 = thresholds.toom_4_square = 10;
+    thresholds.toom_6h = thresholds.toom_6h_square = 26;
+    big_int::set_thresholds(thresholds);
+    for (const int n : {9, 10, 13, 25, 26, 31, 100, 157, 400}) {
+        const auto a = random_test_value(rng, n, true);
+        const auto b = random_test_value(rng, n);
+        const auto expected = big_int_impl::schoolbook_multiply(a, b);
+        EXPECT_EQ(a * b, expected) << "n = " << n;
+        EXPECT_EQ(toom4(a, b), expected) << "n = " << n;
+        EXPECT_EQ(toom6h(a, b), expected) << "n = " << n;
+        auto square = a;
+        big_int_impl::square(square);
+        EXPECT_EQ(square, big_int_impl::schoolbook_multiply(a, a)) << "n = " << n;
+    }
+}
@@ -0,0 +1,237 @@
+//
+// Created by Vyacheslav.Moklev on 18/10/2026.
+//
+
+#include <big_int/big_int.h>
+#include <big_int/big_int_ops.h>
+#include <big_int/bint_divisor.h>
+#include <big_int/thresholds.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+
+/**
+ * Measures crossover points of the algorithms on the local CPU and writes them in the format of
+ * `big_int::read_thresholds`. Usage: `tune_thresholds [output file]`, the result is printed to stdout by default.
+ * Point `FAST_MATH_THRESHOLDS` environment variable to the output file to use the tuned values.
+ */
+
+using namespace big_int;
+
+std::mt19937_64 rng(2024);
+
+bint_t random_value(const int size) {
+    bint_t a;
+    a.data.resize(size);
+    for (auto& limb : a.data) limb = rng();
+    a.data.back() |= 1;
+    return a;
+}
+
+/**
+ * Average time of one `operation` in seconds over a round of at least 10 ms
+ */
+double measure(const std::function<void()>& operation) {
+    using clock = std::chrono::steady_clock;
+    int iterations = 0;
+    const auto start = clock::now();
+    std::chrono::duration<double> elapsed{};
+    do {
+        operation();
+        iterations++;
+        elapsed = clock::now() - start;
+    } while (elapsed.count() < 0.01);
+    return elapsed.count() / iterations;
+}
+
+/**
+ * Best times of `operation` over interleaved rounds with `field = enabled` and with `field = disabled`,
+ * so that the frequency drift affects both configurations equally
+ */
+template<typename T>
+std::pair<double, double> compare_times(thresholds_t& thresholds, T thresholds_t::* field, const T enabled, const T disabled,
+                                        const std::function<void()>& operation) {
+    constexpr int rounds = 5;
+    double new_time = 1e100, old_time = 1e100;
+    for (int round = 0; round < rounds; round++) {
+        thresholds.*field = enabled;
+        set_thresholds(thresholds);
+        new_time = std::min(new_time, measure(operation));
+
+        thresholds.*field = disabled;
+        set_thresholds(thresholds);
+        old_time = std::min(old_time, measure(operation));
+    }
+    return {new_time, old_time};
+}
+
+/**
+ * Finds the smallest size in `[low, high)`, starting from which the algorithm enabled by `field` is faster than
+ * the previous one, by comparing `field = n` with `field = n + 1` for the sizes in a geometric progression.
+ * Returns `high` if the algorithm never wins.
+ */
+int find_crossover(thresholds_t& thresholds, int thresholds_t::* field, const char* name,
+                   const int low, const int high, const std::function<std::function<void()>(int)>& make_operation) {
+    constexpr int required_wins = 3;
+    int wins = 0;
+    int first_win = high;
+    for (int n = low; n < high; n = std::max(n + 1, n * 23 / 20)) {
+        const auto [new_time, old_time] = compare_times(thresholds, field, n, n + 1, make_operation(n));
+        std::cerr << name << ": n = " << n << ", ratio = " << new_time / old_time << std::endl;
+        if (new_time < old_time) {
+            if (wins++ == 0) first_win = n;
+            if (wins == required_wins) break;
+        } else {
+            wins = 0;
+            first_win = high;
+        }
+    }
+
+    thresholds.*field = first_win;
+    set_thresholds(thresholds);
+    std::cerr << name << " = " << first_win << std::endl;
+    return first_win;
+}
+
+constexpr int unbalanced_base = 1000;
+
+/**
+ * Same as `find_crossover` for the minimal ratio of operand sizes in `[low, high)`, starting from which
+ * the unbalanced strategy enabled by `field` is faster. Ratios are tried with the step 0.1 on operands
+ * of `unbalanced_base` limbs and `ratio * unbalanced_base` limbs.
+ */
+double find_ratio_crossover(thresholds_t& thresholds, double thresholds_t::* field, const char* name,
+                            const double low, const double high) {
+    constexpr int required_wins = 3;
+    constexpr double step = 0.1;
+    int wins = 0;
+    double first_win = high;
+    for (double ratio = low; ratio < high; ratio += step) {
+        const auto operation = [a = random_value(static_cast<int>(std::ceil(ratio * unbalanced_base))),
+                                b = random_value(unbalanced_base)] {
+            const auto result = multiply(a, b);
+        };
+        const auto [new_time, old_time] = compare_times(thresholds, field, ratio, ratio + step / 2, operation);
+        std::cerr << name << ": ratio = " << ratio << ", time ratio = " << new_time / old_time << std::endl;
+        if (new_time < old_time) {
+            if (wins++ == 0) first_win = ratio;
+            if (wins == required_wins) break;
+        } else {
+            wins = 0;
+            first_win = high;
+        }
+    }
+
+    thresholds.*field = first_win;
+    set_thresholds(thresholds);
+    std::cerr << name << " = " << first_win << std::endl;
+    return first_win;
+}
+
+std::function<void()> multiply_operation(const int n) {
+    return [a = random_value(n), b = random_value(n)] {
+        const auto result = multiply(a, b);
+    };
+}
+
+std::function<void()> square_operation(const int n) {
+    return [a = random_value(n)] {
+        auto result = a;
+        big_int_impl::square(result);
+    };
+}
+
+std::function<void()> divide_operation(const int n) {
+    return [a = random_value(2 * n), b = random_value(n)] {
+        auto quotient = a;
+        bint_t rem;
+        divide_abs(quotient, b, rem);
+    };
+}
+
+std::function<void()> barrett_operation(const int n) {
+    return [a = random_value(2 * n), divisor = bint_divisor(random_value(n))] {
+        auto quotient = a;
+        bint_t rem;
+        divisor.divide_abs(quotient, rem);
+    };
+}
+
+std::function<void()> divexact_operation(const int n) {
+    return [a = random_value(n) * random_value(n), b = random_value(n)] {
+        const auto result = divexact(a, b);
+    };
+}
+
+std::function<void()> to_string_operation(const int n) {
+    return [a = random_value(n)] {
+        const auto result = a.to_string();
+    };
+}
+
+std::function<void()> from_string_operation(const int n) {
+    return [str = random_value(n).to_string()] {
+        const auto result = bint_t::from_string(str);
+    };
+}
+
+std::function<void()> gcd_operation(const int n) {
+    return [a = random_value(n), b = random_value(n)] {
+        const auto result = gcd(a, b);
+    };
+}
+
+int main(const int argc, char** argv) {
+    // Start from the defaults with the ranges of all multiplication algorithms above Karatsuba empty
+    thresholds_t thresholds;
+    constexpr int never = 1 << 30;
+    thresholds.toom_cook = thresholds.toom_cook_square = never;
+    thresholds.toom_4 = thresholds.toom_4_square = never;
+    thresholds.toom_6h = thresholds.toom_6h_square = never;
+    thresholds.ntt = thresholds.ntt_square = never;
+    thresholds.toom_32_ratio = thresholds.toom_42_ratio = thresholds.unbalanced_slice_ratio = never;
+    set_thresholds(thresholds);
+
+    const int karatsuba = find_crossover(thresholds, &thresholds_t::karatsuba, "karatsuba", 4, 200, multiply_operation);
+    const int karatsuba_square = find_crossover(thresholds, &thresholds_t::karatsuba_square, "karatsuba_square", 4, 200, square_operation);
+    const int toom_cook = find_crossover(thresholds, &thresholds_t::toom_cook, "toom_cook", std::max(karatsuba, 5), 1000, multiply_operation);
+    const int toom_cook_square = find_crossover(thresholds, &thresholds_t::toom_cook_square, "toom_cook_square", std::max(karatsuba_square, 5), 1000, square_operation);
+    const int ntt = find_crossover(thresholds, &thresholds_t::ntt, "ntt", toom_cook, 50000, multiply_operation);
+    const int ntt_square = find_crossover(thresholds, &thresholds_t::ntt_square, "ntt_square", toom_cook_square, 50000, square_operation);
+
+    // Toom-4 and Toom-6.5 are only useful if they beat the previous algorithm before NTT takes over
+    thresholds.toom_4 = ntt;
+    thresholds.toom_4_square = ntt_square;
+    thresholds.toom_6h = ntt;
+    thresholds.toom_6h_square = ntt_square;
+    const int toom_4 = find_crossover(thresholds, &thresholds_t::toom_4, "toom_4", std::max(toom_cook, 10), ntt, multiply_operation);
+    const int toom_4_square = find_crossover(thresholds, &thresholds_t::toom_4_square, "toom_4_square", std::max(toom_cook_square, 10), ntt_square, square_operation);
+    find_crossover(thresholds, &thresholds_t::toom_6h, "toom_6h", std::max(toom_4, 26), ntt, multiply_operation);
+    find_crossover(thresholds, &thresholds_t::toom_6h_square, "toom_6h_square", std::max(toom_4_square, 26), ntt_square, square_operation);
+
+    // Each unbalanced strategy competes with the previous one, starting from the balanced multiplication
+    const double toom_32_ratio = find_ratio_crossover(thresholds, &thresholds_t::toom_32_ratio, "toom_32_ratio", 1, 3);
+    const double toom_42_ratio = find_ratio_crossover(thresholds, &thresholds_t::toom_42_ratio, "toom_42_ratio", toom_32_ratio, 4);
+    find_ratio_crossover(thresholds, &thresholds_t::unbalanced_slice_ratio, "unbalanced_slice_ratio", std::max(toom_42_ratio, 2.0), 8);
+
+    const int burnikel_ziegler = find_crossover(thresholds, &thresholds_t::burnikel_ziegler, "burnikel_ziegler", 4, 1000, divide_operation);
+    find_crossover(thresholds, &thresholds_t::newton_division, "newton_division", std::max(burnikel_ziegler, 5), 200000, divide_operation);
+    find_crossover(thresholds, &thresholds_t::barrett_division, "barrett_division", 2, 5000, barrett_operation);
+    find_crossover(thresholds, &thresholds_t::divexact_via_division, "divexact_via_division", 2, 10000, divexact_operation);
+    find_crossover(thresholds, &thresholds_t::to_string, "to_string", 2, 500, to_string_operation);
+    find_crossover(thresholds, &thresholds_t::from_string, "from_string", 2, 5000, from_string_operation);
+    find_crossover(thresholds, &thresholds_t::hgcd, "hgcd", 4, 2000, gcd_operation);
+
+    if (argc > 1) {
+        std::ofstream output(argv[1]);
+        write_thresholds(output, thresholds);
+    } else {
+        write_thresholds(std::cout, thresholds);
+    }
+    return 0;
+}